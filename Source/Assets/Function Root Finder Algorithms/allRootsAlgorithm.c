@@ -0,0 +1,235 @@
+#include "allRootsAlgorithm.h"
+#include "brentAlgorithm.h"
+#include "../Util/functions.h"
+#include "../Util/util.h"
+#include "../Util/_configurations.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+// kind of a root candidate between grid points
+enum {
+    NO_ROOT = 0, GRID_ROOT, SIGN_CHANGE, TOUCHING_ROOT
+};
+
+static double goldenSectionAbsolute(const CompiledFunction *function, double a, double b, double ete,
+                                    unsigned int maxiter) {
+    /*
+     * Find minimum of |f(x)| in [a, b] with golden section search
+     */
+
+    const double ratio = 0.6180339887498949;
+    double c = b - ratio * (b - a), d = a + ratio * (b - a);
+    double fc = fabs(compiledFunction_n_arg(function, &c)), fd = fabs(compiledFunction_n_arg(function, &d));
+
+    for (unsigned int iter = 0; iter < maxiter && fabs(b - a) > ete; ++iter) {
+        if (fc < fd) {
+            b = d;
+            d = c;
+            fd = fc;
+            c = b - ratio * (b - a);
+            fc = fabs(compiledFunction_n_arg(function, &c));
+        } else {
+            a = c;
+            c = d;
+            fc = fd;
+            d = a + ratio * (b - a);
+            fd = fabs(compiledFunction_n_arg(function, &d));
+        } // end of if
+    } // end of for loop
+
+    return fc < fd ? c : d;
+} // end of goldenSectionAbsolute
+
+unsigned long int allRoots(const char *expression, double a, double b, unsigned int n, double ete, double tol,
+                           unsigned int maxiter, ArrayDouble *roots, int verbose) {
+    /*
+     * This function finds all roots of a function in interval [a, b]. the interval is sampled on n + 1 grid points
+     * in parallel blocks, every sign change between two neighbour points gives a bracket which is refined with
+     * Brent's method and accepted if |f| gets less than tol or than |f| on the two points (so poles like
+     * tan(x) at pi/2 are not roots), and every local minimum of |f| without sign change (a root of even multiplicity like
+     * x^2 = 0) is refined with golden section search on |f| and accepted if |f| gets less than tol there.
+     * roots closer than ete to each other are counted once.
+     *
+     * ARGUMENTS:
+     * expressions  the function expression, it must be a string array like "x^2+1"
+     * a            starting point of interval [a, b]
+     * b            ending point of interval [a, b]
+     * n            number of sub-intervals of the grid
+     * ete          estimated true error of every root
+     * tol          tolerance error, |f(x)| of roots with even multiplicity must be less than this value
+     * maxiter      maximum iteration threshold for refining every root
+     * roots        an uninitialized array which will be initialized and filled with the sorted roots
+     * verbose      show process {0: no, 1: yes}
+     *
+     * RETURN:      number of roots
+     *
+     */
+
+    // fix interval reverse
+    if (a > b){
+        double temp = a;
+        a = b;
+        b = temp;
+    } // end of if
+
+    // check interval
+    if (a == b) {
+        printf("\nError: improper interval!\n");
+        Exit(EXIT_FAILURE);
+    } //end of interval check
+
+    // check n to be more than one
+    // a local minimum needs two neighbours
+    if (n <= 1) {
+        printf("\nError: argument n must be more than one!\n");
+        Exit(EXIT_FAILURE);
+    } // end of n check
+
+    // check error thresholds
+    if (ete <= 0 || tol < 0){
+        printf("\nError: ete or tol argument is not valid.\n");
+        Exit(EXIT_FAILURE);
+    } // end of if
+
+    // check maxiter to be more than zero
+    if (maxiter <= 0) {
+        printf("\nError: argument maxiter must be more than zero!\n");
+        Exit(EXIT_FAILURE);
+    } // end of maxiter check
+
+    // check verbose
+    if (verbose != 0 && verbose != 1) {
+        printf("\nError: verbose argument is not valid.\n");
+        Exit(EXIT_FAILURE);
+    } // end of if
+
+    // initializing variables
+    int threads = 1;
+#ifdef _OPENMP
+    threads = omp_get_max_threads();
+#endif
+    double coefficient = (b - a) / n;
+    double *values = (double *) malloc((n + 1) * sizeof(double));
+    // candidate kind and refined root for every grid point i, candidate lies in [x(i - 1), x(i + 1)]
+    unsigned char *kinds = (unsigned char *) malloc((n + 1) * sizeof(unsigned char));
+    double *candidates = (double *) malloc((n + 1) * sizeof(double));
+    CompiledFunction *functions = (CompiledFunction *) malloc(threads * sizeof(CompiledFunction));
+    long int count = (long int) n + 1;
+
+    if (values == NULL || kinds == NULL || candidates == NULL || functions == NULL) {
+        printf("Unable to allocate memory!\n");
+        Exit(EXIT_FAILURE);
+    } // end of if
+
+    // every thread evaluates it's own copy of the function
+    for (int t = 0; t < threads; ++t) {
+        compileFunction_n_arg(&functions[t], expression, 1);
+    }
+
+    // evaluate the grid in parallel blocks
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static, BLOCK_SIZE) num_threads(threads)
+#endif
+    for (long int i = 0; i < count; ++i) {
+#ifdef _OPENMP
+        const CompiledFunction *function = &functions[omp_get_thread_num()];
+#else
+        const CompiledFunction *function = &functions[0];
+#endif
+        double x = i == n ? b : a + coefficient * (double) i;
+        values[i] = compiledFunction_n_arg(function, &x);
+    } // end of parallel for loop
+
+    // find candidates, a sign change between i and i + 1 belongs to grid point i
+    for (long int i = 0; i < count; ++i) {
+        kinds[i] = NO_ROOT;
+
+        if (values[i] == 0) {
+            kinds[i] = GRID_ROOT;
+        } else if (i < n && values[i] * values[i + 1] < 0) {
+            kinds[i] = SIGN_CHANGE;
+        } else if (i > 0 && i < n && values[i - 1] * values[i] > 0 && values[i] * values[i + 1] > 0 &&
+                   fabs(values[i]) < fabs(values[i - 1]) && fabs(values[i]) <= fabs(values[i + 1])) {
+            kinds[i] = TOUCHING_ROOT;
+        } // end of if
+    } // end of for loop
+
+    // refine candidates in parallel
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 16) num_threads(threads)
+#endif
+    for (long int i = 0; i < count; ++i) {
+#ifdef _OPENMP
+        const CompiledFunction *function = &functions[omp_get_thread_num()];
+#else
+        const CompiledFunction *function = &functions[0];
+#endif
+        double left = a + coefficient * (double) (i - 1), middle = a + coefficient * (double) i, x, fx;
+        int state = 1;
+
+        switch (kinds[i]) {
+            case GRID_ROOT:
+                candidates[i] = middle;
+                break;
+            case SIGN_CHANGE:
+                x = brentCompiled(function, middle, i + 1 == n ? b : middle + coefficient, ete, 0, 0, maxiter, 0,
+                                  &state);
+                candidates[i] = x;
+                // a pole also changes sign, it's only a root if function gets smaller than on the grid points
+                fx = fabs(compiledFunction_n_arg(function, &x));
+                if (!(fx <= tol || fx <= fmin(fabs(values[i]), fabs(values[i + 1])))) {
+                    kinds[i] = NO_ROOT;
+                } // end of if
+                break;
+            case TOUCHING_ROOT:
+                x = goldenSectionAbsolute(function, left, middle + coefficient, ete, maxiter);
+                candidates[i] = x;
+                // it's only a root if function really touches zero there
+                if (!(fabs(compiledFunction_n_arg(function, &x)) <= tol)) {
+                    kinds[i] = NO_ROOT;
+                } // end of if
+                break;
+            default:
+                break;
+        } // end of switch
+    } // end of parallel for loop
+
+    // candidates are in order of grid points, so roots are sorted, only duplicates must be removed
+    initArrayDouble(roots, 16);
+    for (long int i = 0; i < count; ++i) {
+        if (kinds[i] == NO_ROOT) {
+            continue;
+        } // end of if
+
+        if (roots->used > 0 && fabs(candidates[i] - roots->array[roots->used - 1]) < ete) {
+            if (verbose) {
+                printf("Root x = %.10e is a duplicate of the previous root.\n", candidates[i]);
+            } // end if(verbose)
+            continue;
+        } // end of if
+
+        insertToArrayDouble(roots, candidates[i]);
+
+        if (verbose) {
+            printf("Root No. [#%lu]: x = %.10e found %s.\n", roots->used, candidates[i],
+                   kinds[i] == GRID_ROOT ? "on a grid point" :
+                   kinds[i] == SIGN_CHANGE ? "from a sign change" : "at a local minimum of |f(x)|");
+        } // end if(verbose)
+    } // end of for loop
+
+    for (int t = 0; t < threads; ++t) {
+        freeCompiledFunction(&functions[t]);
+    }
+    free(functions);
+    free(values);
+    free(kinds);
+    free(candidates);
+
+    return roots->used;
+} // end of allRoots function
@@ -0,0 +1,33 @@
+#ifndef C_MATH_ALLROOTSALGORITHM_H
+#define C_MATH_ALLROOTSALGORITHM_H
+
+#include "../Util/dynamicArrays1D.h"
+
+unsigned long int allRoots(const char *expression, double a, double b, unsigned int n, double ete, double tol,
+                           unsigned int maxiter, ArrayDouble *roots, int verbose);
+/*
+ * This function finds all roots of a function in interval [a, b]. the interval is sampled on n + 1 grid points
+ * in parallel blocks, every sign change between two neighbour points gives a bracket which is refined with
+ * Brent's method and accepted if |f| gets less than tol or than |f| on the two points (so poles like
+ * tan(x) at pi/2 are not roots), and every local minimum of |f| without sign change (a root of even
+ * multiplicity like x^2 = 0) is refined with golden section search on |f| and accepted if |f| gets less than tol there.
+ * roots closer than ete to each other are counted once. roots of a function which touch zero between two grid
+ * points can be missed, so n must be big enough to separate the roots.
+ *
+ * ARGUMENTS:
+ * expressions  the function expression, it must be a string array like "x^2+1"
+ * a            starting point of interval [a, b]
+ * b            ending point of interval [a, b]
+ * n            number of sub-intervals of the grid
+ * ete          estimated true error of every root
+ * tol          tolerance error, |f(x)| of roots with even multiplicity must be less than this value
+ * maxiter      maximum iteration threshold for refining every root
+ * roots        an uninitialized array which will be initialized and filled with the sorted roots,
+ *              it must be freed with freeArrayDouble
+ * verbose      show process {0: no, 1: yes}
+ *
+ * RETURN:      number of roots
+ *
+ */
+
+#endif //C_MATH_ALLROOTSALGORITHM_H
@@ -0,0 +1,306 @@
+#include "batchRootFinderAlgorithm.h"
+#include "../Util/functions.h"
+#include "../Util/util.h"
+#include "../Util/_configurations.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+typedef struct {
+    // points of unfinished problems as structure of arrays, x then p
+    double points[2 * BLOCK_SIZE];
+    double values[BLOCK_SIZE];
+    // index of unfinished problems in block
+    unsigned int active[BLOCK_SIZE];
+    // state of every problem of block, meaning depends on method
+    double u[BLOCK_SIZE], v[BLOCK_SIZE], fu[BLOCK_SIZE], fv[BLOCK_SIZE];
+} BatchWorkspace;
+
+static void evaluateActive(const CompiledFunction *function, BatchWorkspace *work, unsigned int activeCount,
+                           const double *x, double shift, const double *parameters) {
+    /*
+     * Evaluate f(x[i] + shift; p[i]) for every unfinished problem i in one batch,
+     * result of k-th unfinished problem is written to values[k]
+     */
+
+    for (unsigned int k = 0; k < activeCount; ++k) {
+        work->points[k] = x[work->active[k]] + shift;
+        work->points[BLOCK_SIZE + k] = parameters[work->active[k]];
+    }
+    compiledFunctionBatch_n_arg(function, work->points, activeCount, BLOCK_SIZE, work->values);
+} // end of evaluateActive
+
+static int converged(double ete_err, double ere_err, double fx, double ete, double ere, double tol) {
+    /*
+     * Termination Criterion, same as single problem root finders
+     */
+
+    return (ete != 0 && ete_err < ete) || (ere != 0 && ere_err < ere) || (tol != 0 && fabs(fx) < tol);
+} // end of converged
+
+static void solveBlock(const CompiledFunction *function, BatchWorkspace *work, const double *parameters,
+                       const double *a, const double *b, unsigned int count, unsigned int method, double ete,
+                       double ere, double tol, unsigned int maxiter, double *roots, unsigned int *iterations,
+                       int *states) {
+    /*
+     * Solve one block of at most BLOCK_SIZE problems in lockstep, all arrays start at first problem of block
+     */
+
+    unsigned int activeCount = 0, kept, iter, i;
+    double *u = work->u, *v = work->v, *fu = work->fu, *fv = work->fv, *values = work->values;
+    double x, step, ete_err, ere_err;
+
+    // initialize every problem
+    for (i = 0; i < count; ++i) {
+        u[i] = a[i];
+        v[i] = method == 0 ? 0 : b[i];
+        // fix interval reverse
+        if (method == 2 && u[i] > v[i]) {
+            x = u[i];
+            u[i] = v[i];
+            v[i] = x;
+        } // end of if
+        roots[i] = method == 2 ? -1 : a[i];
+        iterations[i] = 0;
+        states[i] = 1;
+        work->active[activeCount++] = i;
+    } // end of for loop
+
+    if (method == 0) {
+        // f(x0)
+        evaluateActive(function, work, activeCount, u, 0, parameters);
+        for (unsigned int k = 0; k < activeCount; ++k) {
+            fu[work->active[k]] = values[k];
+        }
+    } else {
+        // f(a) and f(b)
+        evaluateActive(function, work, activeCount, u, 0, parameters);
+        for (unsigned int k = 0; k < activeCount; ++k) {
+            fu[work->active[k]] = values[k];
+        }
+        evaluateActive(function, work, activeCount, v, 0, parameters);
+        for (unsigned int k = 0; k < activeCount; ++k) {
+            fv[work->active[k]] = values[k];
+        }
+
+        // bisection needs a correct bracket
+        if (method == 2) {
+            kept = 0;
+            for (unsigned int k = 0; k < activeCount; ++k) {
+                i = work->active[k];
+                if (fu[i] * fv[i] < 0) {
+                    work->active[kept++] = i;
+                } else {
+                    states[i] = 0;
+                } // end of if
+            } // end of for loop
+            activeCount = kept;
+        } // end of if
+    } // end of if
+
+    for (iter = 1; iter <= maxiter && activeCount > 0; ++iter) {
+        switch (method) {
+            case 0: // newton-raphson, u = x, fu = f(x), fv = f'(x)
+                evaluateActive(function, work, activeCount, u, DX, parameters);
+                for (unsigned int k = 0; k < activeCount; ++k) {
+                    fv[work->active[k]] = values[k];
+                }
+                evaluateActive(function, work, activeCount, u, -DX, parameters);
+                for (unsigned int k = 0; k < activeCount; ++k) {
+                    i = work->active[k];
+                    fv[i] = (fv[i] - values[k]) / (2 * DX);
+                }
+                break;
+            case 1: // secant, u = x(n - 1), v = x(n), next point is stored in roots
+                for (unsigned int k = 0; k < activeCount; ++k) {
+                    i = work->active[k];
+                    roots[i] = v[i] - fv[i] * (v[i] - u[i]) / (fv[i] - fu[i]);
+                }
+                evaluateActive(function, work, activeCount, roots, 0, parameters);
+                break;
+            default: // bisection, [u, v] is the bracket, middle point is stored in roots
+                for (unsigned int k = 0; k < activeCount; ++k) {
+                    i = work->active[k];
+                    roots[i] = (u[i] + v[i]) / 2;
+                }
+                evaluateActive(function, work, activeCount, roots, 0, parameters);
+                break;
+        } // end of switch
+
+        // update every problem and keep only unfinished ones
+        kept = 0;
+        for (unsigned int k = 0; k < activeCount; ++k) {
+            i = work->active[k];
+            iterations[i] = iter;
+
+            if (method == 0) {
+                // if derivative is zero newton method can't continue
+                if (fv[i] == 0) {
+                    states[i] = 0;
+                    roots[i] = -1;
+                    continue;
+                } // end of if
+
+                step = fu[i] / fv[i];
+                ete_err = fabs(step);
+                ere_err = fabs(ete_err / u[i]);
+
+                if (converged(ete_err, ere_err, fu[i], ete, ere, tol)) {
+                    roots[i] = u[i];
+                    continue;
+                } // end of if
+
+                u[i] -= step;
+                roots[i] = u[i];
+            } else if (method == 1) {
+                // if f(x(n - 1)) = f(x(n)) secant method can't continue
+                if (fv[i] == fu[i]) {
+                    states[i] = 0;
+                    roots[i] = -1;
+                    continue;
+                } // end of if
+
+                x = roots[i];
+                ete_err = fabs(x - v[i]);
+                ere_err = fabs((x - v[i]) / v[i]);
+
+                if (converged(ete_err, ere_err, values[k], ete, ere, tol)) {
+                    continue;
+                } // end of if
+
+                u[i] = v[i];
+                fu[i] = fv[i];
+                v[i] = x;
+                fv[i] = values[k];
+            } else {
+                x = roots[i];
+                ete_err = (v[i] - u[i]) / 2;
+                ere_err = fabs(ete_err / x);
+
+                if (values[k] == 0 || converged(ete_err, ere_err, values[k], ete, ere, tol)) {
+                    continue;
+                } // end of if
+
+                // keep the half which has a sign change
+                if (values[k] * fu[i] > 0) {
+                    u[i] = x;
+                    fu[i] = values[k];
+                } else {
+                    v[i] = x;
+                    fv[i] = values[k];
+                } // end of if
+            } // end of if
+
+            // this problem needs more iterations
+            work->active[kept++] = i;
+        } // end of for loop
+        activeCount = kept;
+
+        // f(x) of new newton points
+        if (method == 0 && activeCount > 0) {
+            evaluateActive(function, work, activeCount, u, 0, parameters);
+            for (unsigned int k = 0; k < activeCount; ++k) {
+                fu[work->active[k]] = values[k];
+            }
+        } // end of if
+    } // end of for loop
+
+    // answer didn't found
+    for (unsigned int k = 0; k < activeCount; ++k) {
+        states[work->active[k]] = 0;
+    }
+} // end of solveBlock
+
+void batchRootFinder(const char *expression, const double *parameters, const double *a, const double *b,
+                     unsigned long int count, unsigned int method, double ete, double ere, double tol,
+                     unsigned int maxiter, double *roots, unsigned int *iterations, int *states) {
+    /*
+     * This function solves f(x; p) = 0 for many values of parameter p at once, like "x^3-p*x-1".
+     * problems are solved in blocks of BLOCK_SIZE problems which iterate in lockstep, in every iteration
+     * the function is evaluated for all unfinished problems of the block in one batch, and finished problems
+     * are removed from the batch. blocks are solved in parallel.
+     *
+     * ARGUMENTS:
+     * expressions  the function expression, it must be a string array with variables x and p like "x^3-p*x-1"
+     * parameters   array of size count, value of p for every problem
+     * a            array of size count, starting point of newton method, first point of secant method
+     *              or starting point of interval [a, b] of bisection method
+     * b            array of size count, second point of secant method or ending point of interval [a, b]
+     *              of bisection method, it is not used by newton method and can be NULL
+     * count        number of problems
+     * method       root finder method {0: newton-raphson, 1: secant, 2: bisection}
+     * ete          estimated true error
+     * ere          estimated relative error
+     * tol          tolerance error
+     * maxiter      maximum iteration threshold
+     * roots        array of size count, will be filled with root of every problem
+     * iterations   array of size count, will be filled with number of iterations of every problem
+     * states       array of size count, will be filled with state of every problem {0: root not found, 1: found}
+     *
+     */
+
+    // check method and it's points
+    if (method > 2 || (method != 0 && b == NULL)) {
+        printf("\nError: method argument is not valid or b is missing.\n");
+        Exit(EXIT_FAILURE);
+    } // end of if
+
+    // check error thresholds
+    if (ere < 0 || ete < 0 || tol < 0){
+        printf("\nError: ete or ere or tol argument is not valid.\n");
+        Exit(EXIT_FAILURE);
+    } // end of if
+
+    // check maxiter to be more than zero
+    if (maxiter <= 0) {
+        printf("\nError: argument maxiter must be more than zero!\n");
+        Exit(EXIT_FAILURE);
+    } // end of maxiter check
+
+    // initializing variables
+    static const char *names[] = {"x", "p"};
+    long int blocks = (long int) ((count + BLOCK_SIZE - 1) / BLOCK_SIZE);
+    int threads = 1;
+#ifdef _OPENMP
+    threads = omp_get_max_threads();
+#endif
+    CompiledFunction *functions = (CompiledFunction *) malloc(threads * sizeof(CompiledFunction));
+    BatchWorkspace *workspaces = (BatchWorkspace *) malloc(threads * sizeof(BatchWorkspace));
+
+    if (functions == NULL || workspaces == NULL) {
+        printf("Unable to allocate memory!\n");
+        Exit(EXIT_FAILURE);
+    } // end of if
+
+    // every thread evaluates it's own copy of the function
+    for (int t = 0; t < threads; ++t) {
+        compileNamedFunction_n_arg(&functions[t], expression, names, 2);
+    }
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) num_threads(threads)
+#endif
+    for (long int block = 0; block < blocks; ++block) {
+#ifdef _OPENMP
+        int id = omp_get_thread_num();
+#else
+        int id = 0;
+#endif
+        unsigned long int first = (unsigned long int) block * BLOCK_SIZE;
+        unsigned int size = (unsigned int) (count - first < BLOCK_SIZE ? count - first : BLOCK_SIZE);
+
+        solveBlock(&functions[id], &workspaces[id], parameters + first, a + first, b == NULL ? NULL : b + first,
+                   size, method, ete, ere, tol, maxiter, roots + first, iterations + first, states + first);
+    } // end of parallel for loop
+
+    for (int t = 0; t < threads; ++t) {
+        freeCompiledFunction(&functions[t]);
+    }
+    free(functions);
+    free(workspaces);
+} // end of batchRootFinder function
@@ -0,0 +1,32 @@
+#ifndef C_MATH_BATCHROOTFINDERALGORITHM_H
+#define C_MATH_BATCHROOTFINDERALGORITHM_H
+
+void batchRootFinder(const char *expression, const double *parameters, const double *a, const double *b,
+                     unsigned long int count, unsigned int method, double ete, double ere, double tol,
+                     unsigned int maxiter, double *roots, unsigned int *iterations, int *states);
+/*
+ * This function solves f(x; p) = 0 for many values of parameter p at once, like "x^3-p*x-1".
+ * problems are solved in blocks of BLOCK_SIZE problems which iterate in lockstep, in every iteration
+ * the function is evaluated for all unfinished problems of the block in one batch, and finished problems
+ * are removed from the batch. blocks are solved in parallel.
+ *
+ * ARGUMENTS:
+ * expressions  the function expression, it must be a string array with variables x and p like "x^3-p*x-1"
+ * parameters   array of size count, value of p for every problem
+ * a            array of size count, starting point of newton method, first point of secant method
+ *              or starting point of interval [a, b] of bisection method
+ * b            array of size count, second point of secant method or ending point of interval [a, b]
+ *              of bisection method, it is not used by newton method and can be NULL
+ * count        number of problems
+ * method       root finder method {0: newton-raphson, 1: secant, 2: bisection}
+ * ete          estimated true error
+ * ere          estimated relative error
+ * tol          tolerance error
+ * maxiter      maximum iteration threshold
+ * roots        array of size count, will be filled with root of every problem
+ * iterations   array of size count, will be filled with number of iterations of every problem
+ * states       array of size count, will be filled with state of every problem {0: root not found, 1: found}
+ *
+ */
+
+#endif //C_MATH_BATCHROOTFINDERALGORITHM_H
@@ -0,0 +1,252 @@
+#include "brentAlgorithm.h"
+#include "../Util/functions.h"
+#include "../Util/util.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <float.h>
+#include <math.h>
+
+double brent(const char *expression, double a, double b, double ete, double ere, double tol, unsigned int maxiter,
+             int verbose, int *state) {
+    /*
+     * In numerical analysis, Brent's method is a root-finding algorithm combining the bisection method,
+     * the secant method and inverse quadratic interpolation. It has the reliability of bisection but it can be
+     * as quick as some of the less-reliable methods. The algorithm tries to use the potentially fast-converging
+     * secant method or inverse quadratic interpolation if possible, but it falls back to the more robust
+     * bisection method if necessary, so the root always stays inside the bracket [a, b].
+     *
+     * ARGUMENTS:
+     * expressions  the function expression, it must be a string array like "x^2+1"
+     * a            starting point of interval [a, b]
+     * b            ending point of interval [a, b]
+     * ete          estimated true error, compared with half width of the current bracket
+     * ere          estimated relative error
+     * tol          tolerance error
+     * maxiter      maximum iteration threshold
+     * verbose      show process {0: no, 1: yes}
+     * state        is answer found or not, will set value of state to 0 if no answers been found
+     *
+     */
+
+    // fix interval reverse
+    if (a > b){
+        double temp = a;
+        a = b;
+        b = temp;
+    } // end of if
+
+    // check interval
+    if (a == b) {
+        printf("\nError: improper interval!\n");
+        Exit(EXIT_FAILURE);
+    } //end of interval check
+
+    // check error thresholds
+    if (ere < 0 || ete < 0 || tol < 0){
+        printf("\nError: ete or ere or tol argument is not valid.\n");
+        Exit(EXIT_FAILURE);
+    } // end of if
+
+    // check maxiter to be more than zero
+    if (maxiter <= 0) {
+        printf("\nError: argument maxiter must be more than zero!\n");
+        Exit(EXIT_FAILURE);
+    } // end of maxiter check
+
+    // check verbose
+    if (verbose != 0 && verbose != 1) {
+        printf("\nError: verbose argument is not valid.\n");
+        Exit(EXIT_FAILURE);
+    } // end of if
+
+    // compile the expression once for all iterations
+    CompiledFunction function;
+    compileFunction_n_arg(&function, expression, 1);
+
+    double x = brentCompiled(&function, a, b, ete, ere, tol, maxiter, verbose, state);
+
+    freeCompiledFunction(&function);
+    return x;
+} // end of brent function
+
+double brentCompiled(const CompiledFunction *function, double a, double b, double ete, double ere, double tol,
+                     unsigned int maxiter, int verbose, int *state) {
+    /*
+     * Brent's method on a compiled one argument function, arguments are the same as brent function
+     * but they are not checked again. every thread must use it's own compiled function.
+     */
+
+    // calculates y1 = f(a) and y2 =f(b)
+    double fa = compiledFunction_n_arg(function, &a);
+    double fb = compiledFunction_n_arg(function, &b);
+
+    // if f(a) or f(b) is zero, then it's the root
+    if (fa == 0 || fb == 0) {
+        if (verbose) {
+            printf("\nf(x) = 0 at one end of the interval, so it is the root of function.\n\n");
+        } // end if(verbose)
+
+        return fa == 0 ? a : b;
+    } // end of if
+
+    // if y1 and y2 have different signs, then we can use brent method
+    if (fa * fb < 0) {
+
+        // initializing variables
+        // b is the best estimate of root, a is the previous estimate
+        // and c is the other end of bracket, so root is always between b and c
+        unsigned int iter = 1;
+        double c = a, fc = fa;
+        double d = b - a, e = d;
+        double half, minimum, p, q, r, s;
+        double ete_err, ere_err;
+        const char *step;
+
+        while (iter <= maxiter) {
+            // keep root between b and c
+            if ((fb > 0 && fc > 0) || (fb < 0 && fc < 0)) {
+                c = a;
+                fc = fa;
+                d = e = b - a;
+            } // end of if
+
+            // b must be the best estimate
+            if (fabs(fc) < fabs(fb)) {
+                a = b;
+                b = c;
+                c = a;
+                fa = fb;
+                fb = fc;
+                fc = fa;
+            } // end of if
+
+            // half width of bracket, root is at most this far from b
+            half = (c - b) / 2;
+            // the smallest step which is meaningful at b
+            minimum = 2 * DBL_EPSILON * fabs(b);
+
+            //calculate errors
+            ete_err = fabs(half);
+            ere_err = fabs(ete_err / b);
+
+            // Termination Criterion
+            // if f(b) is zero or bracket can't be smaller, then b is the root
+            if (fb == 0 || ete_err <= minimum) {
+                if (verbose) {
+                    printf("\nIn this iteration, bracket [%.10e, %.10e] can't get smaller,\n"
+                           "so x is the root of function.\n\n", b < c ? b : c, b < c ? c : b);
+                } // end if(verbose)
+
+                return b;
+            } // end of if
+
+            // if calculated error is less than estimated true error threshold
+            if (ete != 0 && ete_err < ete) {
+                if (verbose) {
+                    printf("\nIn this iteration, |c - x| / 2 < estimated true error [%.5e < %.5e],\n"
+                           "so x is close enough to the root of function.\n\n", ete_err, ete);
+                } // end if(verbose)
+
+                return b;
+            } // end of estimated true error check
+
+            // if calculated error is less than estimated relative error threshold
+            if (ere != 0 && ere_err < ere) {
+                if (verbose) {
+                    printf("\nIn this iteration, |(c - x) / 2x| < estimated relative error [%.5e < %.5e],\n"
+                           "so x is close enough to the root of function.\n\n", ere_err, ere);
+                } // end if(verbose)
+
+                return b;
+            } // end of estimated relative error check
+
+            // if f(x) is less than tolerance error threshold
+            if (tol != 0 && fabs(fb) < tol) {
+                if (verbose) {
+                    printf("\nIn this iteration, |f(x)| < tolerance [%.5e < %.5e],\n"
+                           "so x is close enough to the root of function.\n\n", fabs(fb), tol);
+                } // end if(verbose)
+
+                return b;
+            } // end of tolerance check
+
+            if (fabs(e) >= minimum && fabs(fa) > fabs(fb)) {
+                // try interpolation
+                s = fb / fa;
+                if (a == c) {
+                    // only two points, use secant method
+                    p = 2 * half * s;
+                    q = 1 - s;
+                    step = "secant";
+                } else {
+                    // use inverse quadratic interpolation
+                    q = fa / fc;
+                    r = fb / fc;
+                    p = s * (2 * half * q * (q - r) - (b - a) * (r - 1));
+                    q = (q - 1) * (r - 1) * (s - 1);
+                    step = "inverse quadratic interpolation";
+                } // end of if
+
+                if (p > 0) {
+                    q = -q;
+                } else {
+                    p = -p;
+                } // end of if
+
+                // accept interpolation only if it falls inside the bracket
+                // and it's step is less than half of the step before the last one
+                if (2 * p < 3 * half * q - fabs(minimum * q) && 2 * p < fabs(e * q)) {
+                    e = d;
+                    d = p / q;
+                } else {
+                    d = half;
+                    e = d;
+                    step = "bisection";
+                } // end of if
+            } else {
+                // interpolation is not useful, use bisection
+                d = half;
+                e = d;
+                step = "bisection";
+            } // end of if
+
+            // move b, at least by the smallest meaningful step
+            a = b;
+            fa = fb;
+            b += fabs(d) > minimum ? d : (half > 0 ? minimum : -minimum);
+            fb = compiledFunction_n_arg(function, &b);
+
+            if (verbose) {
+                printf("\nIteration number [#%d]: x = %10.7lf, f(x) = %.10e, step: %s .\n", iter, b, fb, step);
+            } // end if(verbose)
+
+            iter++;
+        } // end of while loop
+
+        // answer didn't found
+        if (verbose) {
+            if (ete == 0 && ere == 0 && tol == 0) {
+                printf("\nWith maximum iteration of %d\n", maxiter);
+            } else {
+                printf("\nThe solution does not converge or iterations are not sufficient.\n");
+            } // end of if ... else
+
+            printf("the last calculated x is %lf .\n", b);
+        } // end if(verbose)
+
+        // set state to 0 (false)
+        *state = 0;
+        return b;
+
+    } else { // if y1 and y2 have same signs, then we can't use brent method
+        if (verbose) {
+            printf("Incorrect bracketing of function domain!\n"
+                   "keep in mind that the inequality f(a) * f(b) < 0 must be correct\n"
+                   "in order to use Brent method.\n");
+        }// end if(verbose)
+
+        *state = 0;
+        return -1;
+    } // end of if ... else
+} // end of brentCompiled function
@@ -0,0 +1,35 @@
+#ifndef C_MATH_BRENTALGORITHM_H
+#define C_MATH_BRENTALGORITHM_H
+
+#include "../Util/functions.h"
+
+double brent(const char *expression, double a, double b, double ete, double ere, double tol, unsigned int maxiter,
+             int verbose, int *state);
+/*
+ * In numerical analysis, Brent's method is a root-finding algorithm combining the bisection method,
+ * the secant method and inverse quadratic interpolation. It has the reliability of bisection but it can be
+ * as quick as some of the less-reliable methods. The algorithm tries to use the potentially fast-converging
+ * secant method or inverse quadratic interpolation if possible, but it falls back to the more robust
+ * bisection method if necessary, so the root always stays inside the bracket [a, b].
+ *
+ * ARGUMENTS:
+ * expressions  the function expression, it must be a pointer to a string array like "x^2+1"
+ * a            starting point of interval [a, b]
+ * b            ending point of interval [a, b]
+ * ete          estimated true error, compared with half width of the current bracket
+ * ere          estimated relative error
+ * tol          tolerance error
+ * maxiter      maximum iteration threshold
+ * verbose      show process {0: no, 1: yes}
+ * state        is answer found or not, will set value of state to 0 if no answers been found
+ *
+ */
+
+double brentCompiled(const CompiledFunction *function, double a, double b, double ete, double ere, double tol,
+                     unsigned int maxiter, int verbose, int *state);
+/*
+ * Brent's method on a compiled one argument function, arguments are the same as brent function
+ * but they are not checked again. every thread must use it's own compiled function.
+ */
+
+#endif //C_MATH_BRENTALGORITHM_H
@@ -0,0 +1,223 @@
+#include "continuationAlgorithm.h"
+#include "../Util/functions.h"
+#include "../Util/util.h"
+#include "../Util/_configurations.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+static int corrector(const CompiledFunction *function, double *x, double p, double ete, double ere, double tol,
+                     unsigned int maxiter, unsigned int *iterations, double *derivative) {
+    /*
+     * This function solves f(x; p) = 0 for a fixed parameter by Newton's method
+     *
+     * ARGUMENTS:
+     * function     the compiled function with arguments {x, p}
+     * x            starting point, will be replaced by the root
+     * p            value of parameter
+     * ete, ere,    termination thresholds, the same as newtonRaphson function
+     * tol
+     * maxiter      maximum iteration threshold
+     * iterations   number of iterations will be added to it
+     * derivative   receives df/dx at the last point
+     *
+     * RETURN:      is answer found or not {0: no, 1: yes}
+     */
+
+    double point[2], fx, dfx, delta, h;
+    unsigned int iter = 1;
+    point[1] = p;
+
+    while (iter <= maxiter) {
+        ++*iterations;
+
+        // calculate function and it's derivative in the given point
+        point[0] = *x;
+        fx = compiledFunction_n_arg(function, point);
+        h = DX * (1 + fabs(*x));
+        point[0] = *x + h;
+        dfx = compiledFunction_n_arg(function, point);
+        point[0] = *x - h;
+        dfx = (dfx - compiledFunction_n_arg(function, point)) / (2 * h);
+        *derivative = dfx;
+
+        if (!isfinite(fx) || !isfinite(dfx)) {
+            return 0;
+        } // end of if
+
+        // if fx is zero or less than tolerance error threshold
+        if (fx == 0 || (tol != 0 && fabs(fx) < tol)) {
+            return 1;
+        } // end of tolerance check
+
+        // Newton's method can't go on if derivative is equal to zero
+        if (dfx == 0) {
+            return 0;
+        } // end of if
+
+        delta = fx / dfx;
+        *x -= delta;
+
+        // if calculated error is less than estimated true error or estimated relative error threshold
+        if ((ete != 0 && fabs(delta) < ete) || (ere != 0 && fabs(delta / *x) < ere)) {
+            return 1;
+        } // end of error check
+
+        iter++;
+    } // end of while loop
+
+    return 0;
+} // end of corrector
+
+
+unsigned long int continuation(const char *expression, const double *parameters, unsigned long int count, double x0,
+                               double ete, double ere, double tol, unsigned int maxiter, double *roots,
+                               unsigned int *iterations, int *states, int verbose) {
+    /*
+     * This function tracks a root of f(x; p) = 0 along a sweep of parameter p, like "x^3-p*x-1".
+     * the root of every parameter is used to start the next one, the starting point of Newton's method is
+     * predicted by extrapolation of the last roots in p, linear after two roots and quadratic after three roots,
+     * so every parameter needs only a few iterations. if Newton's method doesn't converge from the prediction,
+     * it starts again from the last root.
+     * a turning point (fold) is where df/dx = 0 and the tracked branch of roots ends, it is detected when sign of
+     * df/dx at the root changes between two parameters or the root jumps much farther than it's last step,
+     * then the extrapolation starts again from the new root.
+     *
+     * ARGUMENTS:
+     * expressions  the function expression, it must be a string array with variables x and p like "x^3-p*x-1"
+     * parameters   array of size count, the sweep of p, it must be ordered
+     * count        number of parameters
+     * x0           starting point of Newton's method for the first parameter
+     * ete          estimated true error
+     * ere          estimated relative error
+     * tol          tolerance error
+     * maxiter      maximum iteration threshold of every parameter
+     * roots        array of size count, will be filled with root of every parameter
+     * iterations   array of size count, will be filled with number of iterations of every parameter
+     * states       array of size count, will be filled with state of every parameter
+     *              {0: root not found, 1: found, 2: found after a turning point, it may be on another branch}
+     * verbose      show process {0: no, 1: yes}
+     *
+     * RETURN:      number of parameters which their root has been found
+     *
+     */
+
+    // check count
+    if (count == 0) {
+        printf("\nError: count argument must be more than zero!\n");
+        Exit(EXIT_FAILURE);
+    } // end of if
+
+    // check error thresholds
+    if (ere < 0 || ete < 0 || tol < 0){
+        printf("\nError: ete or ere or tol argument is not valid.\n");
+        Exit(EXIT_FAILURE);
+    } // end of if
+
+    // check maxiter to be more than zero
+    if (maxiter <= 0) {
+        printf("\nError: argument maxiter must be more than zero!\n");
+        Exit(EXIT_FAILURE);
+    } // end of maxiter check
+
+    // check verbose
+    if (verbose != 0 && verbose != 1) {
+        printf("\nError: verbose argument is not valid.\n");
+        Exit(EXIT_FAILURE);
+    } // end of if
+
+    // compile the expression once for all parameters
+    const char *names[] = {"x", "p"};
+    CompiledFunction function;
+    compileNamedFunction_n_arg(&function, expression, names, 2);
+
+    // initializing variables
+    // the last roots of the tracked branch, used for extrapolation
+    double historyP[3], historyX[3];
+    unsigned int history = 0;
+    double x, p, predicted, derivative = 0, lastDerivative = 0, weight;
+    unsigned long int solved = 0;
+    int found;
+
+    for (unsigned long int i = 0; i < count; ++i) {
+        p = parameters[i];
+        iterations[i] = 0;
+
+        // predict the root by lagrange extrapolation of the last roots
+        if (history == 0) {
+            x = x0;
+        } else {
+            x = 0;
+            for (unsigned int j = 0; j < history; ++j) {
+                weight = 1;
+                for (unsigned int k = 0; k < history; ++k) {
+                    if (k != j) {
+                        weight *= (p - historyP[k]) / (historyP[j] - historyP[k]);
+                    } // end of if
+                } // end of for loop
+                x += weight * historyX[j];
+            } // end of for loop
+        } // end of if
+
+        predicted = x;
+        found = corrector(&function, &x, p, ete, ere, tol, maxiter, &iterations[i], &derivative);
+
+        // start again from the last root
+        if (!found && history > 1) {
+            x = historyX[history - 1];
+            found = corrector(&function, &x, p, ete, ere, tol, maxiter, &iterations[i], &derivative);
+        } // end of if
+
+        roots[i] = x;
+
+        if (found) {
+            ++solved;
+            states[i] = 1;
+
+            // df/dx changed it's sign or the root jumped much farther than the last step,
+            // so a turning point has been passed and this root is on another branch
+            if ((history > 0 && ((derivative > 0 && lastDerivative < 0) || (derivative < 0 && lastDerivative > 0))) ||
+                (history > 1 && fabs(x - predicted) >
+                                4 * fabs(historyX[history - 1] - historyX[history - 2]) + ete)) {
+                if (verbose) {
+                    printf("\nA turning point is between p = %lf and p = %lf, root moved from %.5e to %.5e .",
+                           historyP[history - 1], p, historyX[history - 1], x);
+                } // end if(verbose)
+
+                states[i] = 2;
+                history = 0;
+            } // end of if
+
+            // add the root to history and keep the last three roots,
+            // a repeated parameter replaces it's root, so extrapolation never divides by zero
+            if (history > 0 && historyP[history - 1] == p) {
+                --history;
+            } else if (history == 3) {
+                historyP[0] = historyP[1];
+                historyX[0] = historyX[1];
+                historyP[1] = historyP[2];
+                historyX[1] = historyX[2];
+                history = 2;
+            } // end of if
+            historyP[history] = p;
+            historyX[history] = x;
+            ++history;
+            lastDerivative = derivative;
+        } else {
+            states[i] = 0;
+        } // end of if
+
+        if (verbose) {
+            printf("\nParameter number [#%lu]: p = %lf, x = %.10e, iterations = %u, state = %d", i, p, x,
+                   iterations[i], states[i]);
+        } // end if(verbose)
+    } // end of for loop
+
+    if (verbose) {
+        printf("\n\nRoots of %lu parameters out of %lu have been found.\n", solved, count);
+    } // end if(verbose)
+
+    freeCompiledFunction(&function);
+    return solved;
+} // end of continuation function
@@ -0,0 +1,36 @@
+#ifndef C_MATH_CONTINUATIONALGORITHM_H
+#define C_MATH_CONTINUATIONALGORITHM_H
+
+unsigned long int continuation(const char *expression, const double *parameters, unsigned long int count, double x0,
+                               double ete, double ere, double tol, unsigned int maxiter, double *roots,
+                               unsigned int *iterations, int *states, int verbose);
+/*
+ * This function tracks a root of f(x; p) = 0 along a sweep of parameter p, like "x^3-p*x-1".
+ * the root of every parameter is used to start the next one, the starting point of Newton's method is
+ * predicted by extrapolation of the last roots in p, linear after two roots and quadratic after three roots,
+ * so every parameter needs only a few iterations. if Newton's method doesn't converge from the prediction,
+ * it starts again from the last root.
+ * a turning point (fold) is where df/dx = 0 and the tracked branch of roots ends, it is detected when sign of
+ * df/dx at the root changes between two parameters or the root jumps much farther than it's last step,
+ * then the extrapolation starts again from the new root.
+ *
+ * ARGUMENTS:
+ * expressions  the function expression, it must be a string array with variables x and p like "x^3-p*x-1"
+ * parameters   array of size count, the sweep of p, it must be ordered
+ * count        number of parameters
+ * x0           starting point of Newton's method for the first parameter
+ * ete          estimated true error
+ * ere          estimated relative error
+ * tol          tolerance error
+ * maxiter      maximum iteration threshold of every parameter
+ * roots        array of size count, will be filled with root of every parameter
+ * iterations   array of size count, will be filled with number of iterations of every parameter
+ * states       array of size count, will be filled with state of every parameter
+ *              {0: root not found, 1: found, 2: found after a turning point, it may be on another branch}
+ * verbose      show process {0: no, 1: yes}
+ *
+ * RETURN:      number of parameters which their root has been found
+ *
+ */
+
+#endif //C_MATH_CONTINUATIONALGORITHM_H
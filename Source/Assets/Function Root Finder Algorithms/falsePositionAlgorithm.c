@@ -24,7 +24,7 @@ falsePosition(const char *expression, double a, double b, double ete, double ere
      * ere           estimated relative error
      * tol           tolerance error
      * maxiter       maximum iteration threshold
-     * options       use improvement algorithms  {0: no, 1: illinois, 2: anderson-bjork}
+     * options       use improvement algorithms  {0: no, 1: illinois, 2: anderson-bjork, 3: pegasus}
      * verbose       show process {0: no, 1: yes}
      * state         is answer found or not, will set value of state to 0 if no answers been found
      *
@@ -56,20 +56,41 @@ falsePosition(const char *expression, double a, double b, double ete, double ere
     } // end of maxiter check
 
     // check verbose and options value
-    if ((verbose != 0 && verbose != 1) || (options != 0 && options != 1 && options != 2)) {
+    if ((verbose != 0 && verbose != 1) || (options < 0 || options > 3)) {
         printf("\nError: either option or verbose argument is not valid.\n");
         Exit(EXIT_FAILURE);
     } // end of if
 
+    // compile the expression once for all iterations
+    CompiledFunction function;
+    compileFunction_n_arg(&function, expression, 1);
+
+    double x = falsePositionCompiled(&function, a, b, ete, ere, tol, maxiter, options, verbose, state, NULL);
+
+    freeCompiledFunction(&function);
+    return x;
+} // end of false position function
+
+
+double falsePositionCompiled(const CompiledFunction *function, double a, double b, double ete, double ere, double tol,
+                             unsigned int maxiter, int options, int verbose, int *state, unsigned int *evaluations) {
+    /*
+     * False position method on a compiled one argument function, arguments are the same as falsePosition function
+     * but they are not checked again. if evaluations is not NULL, it receives number of evaluations of function.
+     */
+
     // calculates y1 = f(a) and y2 =f(b)
-    double fa = function_1_arg(expression, a);
-    double fb = function_1_arg(expression, b);
+    double fa = compiledFunction_n_arg(function, &a);
+    double fb = compiledFunction_n_arg(function, &b);
+    unsigned int count = 2;
 
     // if y1 and y2 have different signs, then we can use bisection method
     if (fa * fb < 0) {
 
         // initializing variables
         unsigned int iter = 1;
+        // which end of interval has been replaced in the last iteration {-1: a, 0: none, 1: b}
+        int side = 0;
         double m;
         double x = 0;
         double ete_err;
@@ -79,7 +100,8 @@ falsePosition(const char *expression, double a, double b, double ete, double ere
             // calculate x
             x = (a * fb - b * fa) / (fb - fa);
             // evaluate the function at point x, y3 =f(x)
-            double fc = function_1_arg(expression, x);
+            double fc = compiledFunction_n_arg(function, &x);
+            ++count;
 
             if (verbose) {
                 printf("\nIteration number [#%d]: x = %10.7lf, f(x) = %.10e .\n", iter, x, fc);
@@ -91,16 +113,24 @@ falsePosition(const char *expression, double a, double b, double ete, double ere
                 //calculate true error
                 ete_err = fabs(a - x);
 
+                // use illinois, anderson-bjork or pegasus algorithm to improve regula falsi,
+                // if a is replaced again, b is stuck, so f(b) is scaled down to move next x toward b
+                if (options && side == -1) {
+                    if (options == 1) {
+                        fb /= 2;
+                    } else if (options == 2) {
+                        m = 1 - fc / fa;
+                        fb *= m > 0 ? m : 0.5;
+                    } else {
+                        fb *= fa / (fa + fc);
+                    } // end of if
+                } // end of if
+                side = -1;
+
                 // substitute
                 a = x;
                 fa = fc;
 
-                // use illinois or anderson-bjork algorithm to improve regula falsi
-                if (options){
-                    m = 1 - fc / fa;
-                    fb = options == 1 ? fb / 2 : (m > 1 ? fb * m : fb / 2);
-                }
-
                 if (verbose) {
                     printf("In this iteration, a replaced by x, new range is [%lf, %lf].\n", a, b);
                 } // end if(verbose)
@@ -110,16 +140,24 @@ falsePosition(const char *expression, double a, double b, double ete, double ere
                 //calculate true error
                 ete_err = fabs(b - x);
 
+                // use illinois, anderson-bjork or pegasus algorithm to improve regula falsi,
+                // if b is replaced again, a is stuck, so f(a) is scaled down to move next x toward a
+                if (options && side == 1) {
+                    if (options == 1) {
+                        fa /= 2;
+                    } else if (options == 2) {
+                        m = 1 - fc / fb;
+                        fa *= m > 0 ? m : 0.5;
+                    } else {
+                        fa *= fb / (fb + fc);
+                    } // end of if
+                } // end of if
+                side = 1;
+
                 // substitute
                 b = x;
                 fb = fc;
 
-                // use illinois or anderson-bjork algorithm to improve regula falsi
-                if (options){
-                    m = 1 - fc / fb;
-                    fa = options == 1 ? fa / 2 : (m > 1 ? fa * m : fa / 2);
-                }
-
                 if (verbose) {
                     printf("In this iteration, b replaced by x, new range is [%lf, %lf].\n", a, b);
                 } // end if(verbose)
@@ -129,6 +167,10 @@ falsePosition(const char *expression, double a, double b, double ete, double ere
                     printf("In this iteration, f(x) = 0, so x is the root of function.\n\n");
                 } // end if(verbose)
 
+                if (evaluations != NULL) {
+                    *evaluations = count;
+                } // end of if
+
                 return x;
             } // end of if .. else if chained decisions
 
@@ -143,6 +185,10 @@ falsePosition(const char *expression, double a, double b, double ete, double ere
                            "so x is close enough to the root of function.\n\n", iter, iter - 1, ete_err, ete);
                 } // end if(verbose)
 
+                if (evaluations != NULL) {
+                    *evaluations = count;
+                } // end of if
+
                 return x;
             } // end of estimated true error check
 
@@ -153,6 +199,10 @@ falsePosition(const char *expression, double a, double b, double ete, double ere
                            "so x is close enough to the root of function.\n\n", iter, iter - 1, iter, ere_err, ere);
                 } // end if(verbose)
 
+                if (evaluations != NULL) {
+                    *evaluations = count;
+                } // end of if
+
                 return x;
             } // end of estimated relative error check
 
@@ -163,6 +213,10 @@ falsePosition(const char *expression, double a, double b, double ete, double ere
                            "so x is close enough to the root of function.\n\n", fabs(fc), tol);
                 } // end if(verbose)
 
+                if (evaluations != NULL) {
+                    *evaluations = count;
+                } // end of if
+
                 return x;
             } // end of tolerance check
 
@@ -180,6 +234,10 @@ falsePosition(const char *expression, double a, double b, double ete, double ere
             printf("the last calculated x is %lf .\n", x);
         } // end if(verbose)
 
+        if (evaluations != NULL) {
+            *evaluations = count;
+        } // end of if
+
         // set state to 0 (false)
         *state = 0;
         return x;
@@ -191,7 +249,11 @@ falsePosition(const char *expression, double a, double b, double ete, double ere
                    "in order to use false position method.\n");
         }// end if(verbose)
 
+        if (evaluations != NULL) {
+            *evaluations = count;
+        } // end of if
+
         *state = 0;
         return -1;
     } // end of if ... else
-} // end of false position function
+} // end of falsePositionCompiled function
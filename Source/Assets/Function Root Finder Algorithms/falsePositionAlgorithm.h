@@ -1,6 +1,8 @@
 #ifndef C_MATH_FALSEPOSITIONALGORITHM_H
 #define C_MATH_FALSEPOSITIONALGORITHM_H
 
+#include "../Util/functions.h"
+
 double
 falsePosition(const char *expression, double a, double b, double ete, double ere, double tol, unsigned int maxiter,
               int options, int verbose, int *state);
@@ -19,10 +21,20 @@ falsePosition(const char *expression, double a, double b, double ete, double ere
  * ere           estimated relative error
  * tol           tolerance error
  * maxiter       maximum iteration threshold
- * options       use improvement algorithms  {0: no, 1: illinois, 2: anderson-bjork}
+ * options       use improvement algorithms  {0: no, 1: illinois, 2: anderson-bjork, 3: pegasus}
+ *               when the same end of interval is replaced twice in a row, the value of function at the other end
+ *               is scaled down by 1/2 (illinois), by 1 - f(x)/f(old) or 1/2 if it's negative (anderson-bjork)
+ *               or by f(old) / (f(old) + f(x)) (pegasus), so the stuck end moves and convergence is superlinear
  * verbose       show process {0: no, 1: yes}
  * state         is answer found or not, will set value of state to 0 if no answers been found
  *
  */
 
+double falsePositionCompiled(const CompiledFunction *function, double a, double b, double ete, double ere, double tol,
+                             unsigned int maxiter, int options, int verbose, int *state, unsigned int *evaluations);
+/*
+ * False position method on a compiled one argument function, arguments are the same as falsePosition function
+ * but they are not checked again. if evaluations is not NULL, it receives number of evaluations of function.
+ */
+
 #endif //C_MATH_FALSEPOSITIONALGORITHM_H
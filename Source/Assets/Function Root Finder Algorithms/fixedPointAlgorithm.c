@@ -0,0 +1,185 @@
+#include "fixedPointAlgorithm.h"
+#include "../Util/functions.h"
+#include "../Util/util.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+static double iterationFunction(const CompiledFunction *function, double x, int transform) {
+    /*
+     * This function evaluates g(x), for transformed expressions g(x) = x - f(x)
+     *
+     * ARGUMENTS:
+     * function     the compiled function
+     * x            the point where g must be evaluated
+     * transform    type of expression {0: g(x), 1: f(x)}
+     */
+
+    double value = compiledFunction_n_arg(function, &x);
+    return transform ? x - value : value;
+} // end of iterationFunction
+
+
+double fixedPoint(const char *expression, double x0, int transform, int options, double ete, double ere, double tol,
+                  unsigned int maxiter, int verbose, int *state) {
+    /*
+     * In numerical analysis, fixed-point iteration is a method of computing fixed points of a function g,
+     * the points where x = g(x). starting from x0, the iteration x1 = g(x0) converges linearly to a fixed point
+     * if |g'(x)| < 1 around it.
+     * Aitken's delta-squared process accelerates a linearly converging sequence x0, x1 = g(x0), x2 = g(x1) by:
+     *
+     * x = x0 - (x1 - x0)^2 / (x2 - 2 * x1 + x0)
+     *
+     * and Steffensen's method restarts the iteration from this accelerated value, so it converges quadratically
+     * without any derivatives. an equation f(x) = 0 is transformed to the fixed point problem x = x - f(x),
+     * then Steffensen's method is x1 = x0 - f(x0)^2 / (f(x0) - f(x0 - f(x0))).
+     *
+     * ARGUMENTS:
+     * expressions  the function expression, it must be a string array like "cos(x)"
+     * x0           starting point
+     * transform    type of expression {0: expression is g(x) and solves x = g(x), 1: expression is f(x) and
+     *              solves f(x) = 0 by g(x) = x - f(x)}
+     * options      acceleration {0: no, 1: aitken, 2: steffensen}
+     * ete          estimated true error
+     * ere          estimated relative error
+     * tol          tolerance error, compared with |g(x) - x| which is |f(x)| for transformed expressions
+     * maxiter      maximum iteration threshold
+     * verbose      show process {0: no, 1: yes}
+     * state        is answer found or not, will set value of state to 0 if no answers been found
+     *
+     */
+
+    // check error thresholds
+    if (ere < 0 || ete < 0 || tol < 0){
+        printf("\nError: ete or ere or tol argument is not valid.\n");
+        Exit(EXIT_FAILURE);
+    } // end of if
+
+    // check maxiter to be more than zero
+    if (maxiter <= 0) {
+        printf("\nError: argument maxiter must be more than zero!\n");
+        Exit(EXIT_FAILURE);
+    } // end of maxiter check
+
+    // check verbose, transform and options value
+    if ((verbose != 0 && verbose != 1) || (transform != 0 && transform != 1) || (options < 0 || options > 2)) {
+        printf("\nError: either transform, option or verbose argument is not valid.\n");
+        Exit(EXIT_FAILURE);
+    } // end of if
+
+    // compile the expression once for all iterations
+    CompiledFunction function;
+    compileFunction_n_arg(&function, expression, 1);
+
+    // initializing variables
+    // x is the current estimate, x1 = g(x0) and x2 = g(x1) are the plain iterations
+    double x = x0, xNew, residual;
+    double x1 = iterationFunction(&function, x0, transform), x2, denominator;
+    double ete_err, ere_err;
+    unsigned int iter = 1;
+
+    while (iter <= maxiter) {
+        // |g(x) - x| shows how far x is from a fixed point
+        if (options == 1) {
+            // the accelerated estimate isn't on the plain sequence, so it's residual needs an evaluation
+            residual = fabs(iterationFunction(&function, x, transform) - x);
+        } else {
+            residual = fabs(x1 - x);
+        } // end of if
+
+        if (options == 0) {
+            xNew = x1;
+        } else {
+            x2 = iterationFunction(&function, x1, transform);
+            denominator = x2 - 2 * x1 + x0;
+
+            // if differences are zero, the sequence has already reached it's limit
+            xNew = denominator != 0 ? x0 - (x1 - x0) * (x1 - x0) / denominator : x2;
+        } // end of if
+
+        if (verbose) {
+            printf("\nIteration number [#%d]: x%d = %.10e, |g(x%d) - x%d| = %.5e .\n", iter, iter, xNew,
+                   iter - 1, iter - 1, residual);
+        } // end of if verbose
+
+        // calculate errors
+        ete_err = fabs(xNew - x);
+        ere_err = fabs(ete_err / xNew);
+
+        // Termination Criterion
+        // if x is exactly a fixed point
+        if (residual == 0) {
+            if (verbose) {
+                printf("\nIn this iteration, g(x%d) = x%d, so x is the fixed point.\n\n", iter - 1, iter - 1);
+            } // end if(verbose)
+
+            freeCompiledFunction(&function);
+            return x;
+        } // end of if
+
+        // if calculated error is less than estimated true error threshold
+        if (ete != 0 && ete_err < ete) {
+            if (verbose) {
+                printf("\nIn this iteration, |x%d - x%d| < estimated true error [%.5e < %.5e],\n"
+                       "so x is close enough to the fixed point.\n\n", iter, iter - 1, ete_err, ete);
+            } // end if(verbose)
+
+            freeCompiledFunction(&function);
+            return xNew;
+        } // end of estimated true error check
+
+        // if calculated error is less than estimated relative error threshold
+        if (ere != 0 && ere_err < ere) {
+            if (verbose) {
+                printf("\nIn this iteration, |(x%d - x%d / x%d)| < estimated relative error [%.5e < %.5e],\n"
+                       "so x is close enough to the fixed point.\n\n", iter, iter - 1, iter, ere_err, ere);
+            } // end if(verbose)
+
+            freeCompiledFunction(&function);
+            return xNew;
+        } // end of estimated relative error check
+
+        // if g(x) - x is less than tolerance error threshold
+        if (tol != 0 && residual < tol) {
+            if (verbose) {
+                printf("\nIn this iteration, |g(x%d) - x%d| < tolerance [%.5e < %.5e],\n"
+                       "so x is close enough to the fixed point.\n\n", iter - 1, iter - 1, residual, tol);
+            } // end if(verbose)
+
+            freeCompiledFunction(&function);
+            return x;
+        } // end of tolerance check
+
+        // go to the next iteration
+        if (options == 1) {
+            // aitken accelerates the plain sequence, which goes on without change
+            x0 = x1;
+            x1 = x2;
+        } else {
+            // plain iteration and steffensen start again from the new estimate
+            x0 = xNew;
+            x1 = iterationFunction(&function, x0, transform);
+        } // end of if
+
+        x = xNew;
+        iter++;
+    } // end of while loop
+
+    freeCompiledFunction(&function);
+
+    // answer didn't found
+    if (verbose) {
+        if (ete == 0 && ere == 0 && tol == 0) {
+            printf("\nWith maximum iteration of %d\n", maxiter);
+        } else {
+            printf("\nThe solution does not converge or iterations are not sufficient.\n");
+        } // end of if ... else
+
+        printf("the last calculated x is %lf .\n", x);
+    } // end if(verbose)
+
+    // set state to 0 (false)
+    *state = 0;
+    return x;
+} // end of fixed point function
@@ -0,0 +1,33 @@
+#ifndef C_MATH_FIXEDPOINTALGORITHM_H
+#define C_MATH_FIXEDPOINTALGORITHM_H
+
+double fixedPoint(const char *expression, double x0, int transform, int options, double ete, double ere, double tol,
+                  unsigned int maxiter, int verbose, int *state);
+/*
+ * In numerical analysis, fixed-point iteration is a method of computing fixed points of a function g,
+ * the points where x = g(x). starting from x0, the iteration x1 = g(x0) converges linearly to a fixed point
+ * if |g'(x)| < 1 around it.
+ * Aitken's delta-squared process accelerates a linearly converging sequence x0, x1 = g(x0), x2 = g(x1) by:
+ *
+ * x = x0 - (x1 - x0)^2 / (x2 - 2 * x1 + x0)
+ *
+ * and Steffensen's method restarts the iteration from this accelerated value, so it converges quadratically
+ * without any derivatives. an equation f(x) = 0 is transformed to the fixed point problem x = x - f(x),
+ * then Steffensen's method is x1 = x0 - f(x0)^2 / (f(x0) - f(x0 - f(x0))).
+ *
+ * ARGUMENTS:
+ * expressions  the function expression, it must be a pointer to a string array like "cos(x)"
+ * x0           starting point
+ * transform    type of expression {0: expression is g(x) and solves x = g(x), 1: expression is f(x) and
+ *              solves f(x) = 0 by g(x) = x - f(x)}
+ * options      acceleration {0: no, 1: aitken, 2: steffensen}
+ * ete          estimated true error
+ * ere          estimated relative error
+ * tol          tolerance error, compared with |g(x) - x| which is |f(x)| for transformed expressions
+ * maxiter      maximum iteration threshold
+ * verbose      show process {0: no, 1: yes}
+ * state        is answer found or not, will set value of state to 0 if no answers been found
+ *
+ */
+
+#endif //C_MATH_FIXEDPOINTALGORITHM_H
@@ -0,0 +1,260 @@
+#include "householderAlgorithm.h"
+#include "../Util/functions.h"
+#include "../Util/util.h"
+#include "../Util/_configurations.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+static double derivatives(const CompiledFunction *function, double x, unsigned int order, double *d1, double *d2,
+                          double *d3) {
+    /*
+     * This function estimates f(x) and derivatives of f up to the order by central differences,
+     * the step of each order balances truncation error and round off error
+     *
+     * ARGUMENTS:
+     * function     the compiled function
+     * x            the point where derivatives must be evaluated
+     * order        highest derivative which is needed {1, 2, 3}
+     * d1, d2, d3   receive f'(x), f''(x) and f'''(x), only up to the order
+     *
+     * RETURN:      f(x)
+     */
+
+    double point, f, fp1, fm1, fp2, fm2, h;
+
+    point = x;
+    f = compiledFunction_n_arg(function, &point);
+
+    if (order == 1) {
+        h = DX;
+    } else if (order == 2) {
+        h = 1e-4 * (1 + fabs(x));
+    } else {
+        h = 1e-3 * (1 + fabs(x));
+    } // end of if
+
+    point = x + h;
+    fp1 = compiledFunction_n_arg(function, &point);
+    point = x - h;
+    fm1 = compiledFunction_n_arg(function, &point);
+
+    if (order < 3) {
+        *d1 = (fp1 - fm1) / (2 * h);
+        if (order == 2) {
+            *d2 = (fp1 - 2 * f + fm1) / (h * h);
+        } // end of if
+
+        return f;
+    } // end of if
+
+    // five point stencil for the third order
+    point = x + 2 * h;
+    fp2 = compiledFunction_n_arg(function, &point);
+    point = x - 2 * h;
+    fm2 = compiledFunction_n_arg(function, &point);
+
+    *d1 = (fm2 - 8 * fm1 + 8 * fp1 - fp2) / (12 * h);
+    *d2 = (-fm2 + 16 * fm1 - 30 * f + 16 * fp1 - fp2) / (12 * h * h);
+    *d3 = (fp2 - 2 * fp1 + 2 * fm1 - fm2) / (2 * h * h * h);
+
+    return f;
+} // end of derivatives
+
+
+double householder(const char *expression, double x0, unsigned int order, double ete, double ere, double tol,
+                   unsigned int maxiter, int verbose, int *state, unsigned int *iterations, unsigned int *evaluations) {
+    /*
+     * In numerical analysis, the class of Householder's methods are root-finding algorithms used for functions of
+     * one real variable with continuous derivatives up to some order d + 1. Each of these methods is characterized
+     * by the number d, which is known as the order of the method, and it's rate of convergence is d + 1:
+     *
+     * x1 = x0 + d * (1/f)^(d-1)(x0) / (1/f)^(d)(x0)
+     *
+     * order 1 is Newton's method, order 2 is Halley's method:  x1 = x0 - 2 * f * f' / (2 * f'^2 - f * f'')
+     * and order 3 is:  x1 = x0 - 3 * f * (2 * f'^2 - f * f'') / (6 * f'^3 - 6 * f * f' * f'' + f^2 * f''')
+     *
+     * derivatives are estimated by central differences, orders 1 and 2 need 3 evaluations of function in every
+     * iteration and order 3 needs 5 evaluations, so Halley's method costs the same as Newton's method per iteration.
+     *
+     * ARGUMENTS:
+     * expressions  the function expression, it must be a string array like "x^2+1"
+     * x0           starting point
+     * order        order of method {1: Newton, 2: Halley, 3: third order Householder}
+     * ete          estimated true error
+     * ere          estimated relative error
+     * tol          tolerance error
+     * maxiter      maximum iteration threshold
+     * verbose      show process {0: no, 1: yes}
+     * state        is answer found or not, will set value of state to 0 if no answers been found
+     * iterations   if it's not NULL, receives number of iterations
+     * evaluations  if it's not NULL, receives number of evaluations of function
+     *
+     */
+
+    // check order
+    if (order < 1 || order > 3) {
+        printf("\nError: order argument is not valid.\n");
+        Exit(EXIT_FAILURE);
+    } // end of if
+
+    // check error thresholds
+    if (ere < 0 || ete < 0 || tol < 0){
+        printf("\nError: ete or ere or tol argument is not valid.\n");
+        Exit(EXIT_FAILURE);
+    } // end of if
+
+    // check maxiter to be more than zero
+    if (maxiter <= 0) {
+        printf("\nError: argument maxiter must be more than zero!\n");
+        Exit(EXIT_FAILURE);
+    } // end of maxiter check
+
+    // check verbose
+    if (verbose != 0 && verbose != 1) {
+        printf("\nError: verbose argument is not valid.\n");
+        Exit(EXIT_FAILURE);
+    } // end of if
+
+    // initializing variables
+    CompiledFunction function;
+    compileFunction_n_arg(&function, expression, 1);
+
+    double x = x0;
+    double fx, d1 = 0, d2 = 0, d3 = 0, numerator, denominator, delta;
+    double ete_err, ere_err;
+    unsigned int iter = 1, count = 0;
+    const unsigned int perIteration = order < 3 ? 3 : 5;
+
+    while (iter <= maxiter) {
+        // calculate function and it's derivatives in the given point
+        fx = derivatives(&function, x, order, &d1, &d2, &d3);
+        count += perIteration;
+
+        // calculate the step
+        if (order == 1) {
+            numerator = fx;
+            denominator = d1;
+        } else if (order == 2) {
+            numerator = 2 * fx * d1;
+            denominator = 2 * d1 * d1 - fx * d2;
+        } else {
+            numerator = 3 * fx * (2 * d1 * d1 - fx * d2);
+            denominator = 6 * d1 * d1 * d1 - 6 * fx * d1 * d2 + fx * fx * d3;
+        } // end of if
+
+        // f(x) is exactly zero, so x is the root
+        if (fx == 0) {
+            if (verbose) {
+                printf("\nIn this iteration, f(x%d) = 0, so x is the root of function.\n\n", iter - 1);
+            } // end if(verbose)
+
+            break;
+        } // end of if
+
+        // if denominator is equal to zero
+        if (denominator == 0) {
+            if (verbose) {
+                printf("Householder method of order %u can't continue because the denominator of it's step is zero!\n"
+                       "check your function and if you think it has derivatives\n"
+                       "then try to choose a better starting point x0 .\n", order);
+            } // end if(verbose)
+
+            // set state to 0 (false)
+            *state = 0;
+            x = -1;
+            break;
+        } // end of if
+
+        delta = numerator / denominator;
+
+        if (verbose) {
+            printf("\nIteration number [#%d]: f(x%d) = %lf, f'(x%d) = %lf, delta(x%d) = %lf\n"
+                   "\t\t\tx%d = x%d - delta(x%d) = %.10e .\n", iter, iter - 1, fx, iter - 1, d1, iter - 1,
+                   delta, iter, iter - 1, iter - 1, x - delta);
+        } // end of if verbose
+
+        // calculate errors
+        ete_err = fabs(delta);
+        ere_err = fabs(ete_err / x);
+
+        // Termination Criterion
+        // if calculated error is less than estimated true error threshold
+        if (ete != 0 && ete_err < ete) {
+            if (verbose) {
+                printf("\nIn this iteration, |x%d - x%d| < estimated true error [%.5e < %.5e],\n"
+                       "so x is close enough to the root of function.\n\n", iter, iter - 1, ete_err, ete);
+            } // end if(verbose)
+
+            break;
+        } // end of estimated true error check
+
+        // if calculated error is less than estimated relative error threshold
+        if (ere != 0 && ere_err < ere) {
+            if (verbose) {
+                printf("\nIn this iteration, |(x%d - x%d / x%d)| < estimated relative error [%.5e < %.5e],\n"
+                       "so x is close enough to the root of function.\n\n", iter, iter - 1, iter, ere_err, ere);
+            } // end if(verbose)
+
+            break;
+        } // end of estimated relative error check
+
+        // if fx is less than tolerance error threshold
+        if (tol != 0 && fabs(fx) < tol) {
+            if (verbose) {
+                printf("\nIn this iteration, |f(x%d)| < tolerance [%.5e < %.5e],\n"
+                       "so x is close enough to the root of function.\n\n", iter, fabs(fx), tol);
+            } // end if(verbose)
+
+            break;
+        } // end of tolerance check
+
+        x -= delta;
+        iter++;
+    } // end of while loop
+
+    freeCompiledFunction(&function);
+
+    // answer didn't found
+    if (iter > maxiter) {
+        if (verbose) {
+            if (ete == 0 && ere == 0 && tol == 0) {
+                printf("\nWith maximum iteration of %d\n", maxiter);
+            } else {
+                printf("\nThe solution does not converge or iterations are not sufficient.\n");
+            } // end of if ... else
+
+            printf("the last calculated x is %lf .\n", x);
+        } // end if(verbose)
+
+        // set state to 0 (false)
+        *state = 0;
+        x = -1;
+        iter = maxiter;
+    } // end of if
+
+    if (verbose) {
+        printf("Number of iterations: %u, number of function evaluations: %u\n", iter, count);
+    } // end if(verbose)
+
+    if (iterations != NULL) {
+        *iterations = iter;
+    } // end of if
+
+    if (evaluations != NULL) {
+        *evaluations = count;
+    } // end of if
+
+    return x;
+} // end of householder function
+
+
+double halley(const char *expression, double x0, double ete, double ere, double tol, unsigned int maxiter,
+              int verbose, int *state, unsigned int *iterations, unsigned int *evaluations) {
+    /*
+     * Halley's method, it's the householder function with order 2
+     */
+
+    return householder(expression, x0, 2, ete, ere, tol, maxiter, verbose, state, iterations, evaluations);
+} // end of halley function
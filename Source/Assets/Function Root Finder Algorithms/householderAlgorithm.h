@@ -0,0 +1,40 @@
+#ifndef C_MATH_HOUSEHOLDERALGORITHM_H
+#define C_MATH_HOUSEHOLDERALGORITHM_H
+
+double householder(const char *expression, double x0, unsigned int order, double ete, double ere, double tol,
+                   unsigned int maxiter, int verbose, int *state, unsigned int *iterations, unsigned int *evaluations);
+/*
+ * In numerical analysis, the class of Householder's methods are root-finding algorithms used for functions of
+ * one real variable with continuous derivatives up to some order d + 1. Each of these methods is characterized
+ * by the number d, which is known as the order of the method, and it's rate of convergence is d + 1:
+ *
+ * x1 = x0 + d * (1/f)^(d-1)(x0) / (1/f)^(d)(x0)
+ *
+ * order 1 is Newton's method, order 2 is Halley's method:  x1 = x0 - 2 * f * f' / (2 * f'^2 - f * f'')
+ * and order 3 is:  x1 = x0 - 3 * f * (2 * f'^2 - f * f'') / (6 * f'^3 - 6 * f * f' * f'' + f^2 * f''')
+ *
+ * derivatives are estimated by central differences, orders 1 and 2 need 3 evaluations of function in every
+ * iteration and order 3 needs 5 evaluations, so Halley's method costs the same as Newton's method per iteration.
+ *
+ * ARGUMENTS:
+ * expressions  the function expression, it must be a pointer to a string array like "x^2+1"
+ * x0           starting point
+ * order        order of method {1: Newton, 2: Halley, 3: third order Householder}
+ * ete          estimated true error
+ * ere          estimated relative error
+ * tol          tolerance error
+ * maxiter      maximum iteration threshold
+ * verbose      show process {0: no, 1: yes}
+ * state        is answer found or not, will set value of state to 0 if no answers been found
+ * iterations   if it's not NULL, receives number of iterations
+ * evaluations  if it's not NULL, receives number of evaluations of function
+ *
+ */
+
+double halley(const char *expression, double x0, double ete, double ere, double tol, unsigned int maxiter,
+              int verbose, int *state, unsigned int *iterations, unsigned int *evaluations);
+/*
+ * Halley's method, it's the householder function with order 2
+ */
+
+#endif //C_MATH_HOUSEHOLDERALGORITHM_H
@@ -0,0 +1,299 @@
+#include "polynomialRootsAlgorithm.h"
+#include "../Util/functions.h"
+#include "../Util/util.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <float.h>
+#include <math.h>
+
+// complex numbers are written by hand, because complex.h is not available in every compiler
+typedef struct {
+    double re;
+    double im;
+} Complex;
+
+static Complex complexSub(Complex a, Complex b) {
+    Complex c = {a.re - b.re, a.im - b.im};
+    return c;
+}
+
+static Complex complexMul(Complex a, Complex b) {
+    Complex c = {a.re * b.re - a.im * b.im, a.re * b.im + a.im * b.re};
+    return c;
+}
+
+static Complex complexDiv(Complex a, Complex b) {
+    // scaled division to avoid overflow
+    Complex c;
+    if (fabs(b.re) >= fabs(b.im)) {
+        double r = b.im / b.re, d = b.re + r * b.im;
+        c.re = (a.re + r * a.im) / d;
+        c.im = (a.im - r * a.re) / d;
+    } else {
+        double r = b.re / b.im, d = b.im + r * b.re;
+        c.re = (r * a.re + a.im) / d;
+        c.im = (r * a.im - a.re) / d;
+    } // end of if
+    return c;
+}
+
+static double complexAbs(Complex a) {
+    return hypot(a.re, a.im);
+}
+
+
+unsigned int polynomialRoots(const char *expression, unsigned int maxDegree, double ete, double ere,
+                             unsigned int maxiter, double *realParts, double *imaginaryParts, int verbose, int *state) {
+    /*
+     * If the expression is a polynomial in x, like "(x-1)^3*(x^2+4)", this function finds all of it's real and
+     * complex roots at once by Aberth-Ehrlich method. the method improves all of the roots simultaneously,
+     * every root is corrected by Newton step of p(x) divided by the product of it's distances to the other roots.
+     * each iteration costs O(n^2) and convergence is cubic for simple roots.
+     *
+     * ARGUMENTS:
+     * expressions      the function expression, it must be a string array like "x^3-2*x-5"
+     * maxDegree        maximum degree of polynomial, realParts and imaginaryParts must have this size
+     * ete              estimated true error, compared with the last correction of every root
+     * ere              estimated relative error, compared with the last correction of every root divided by it's size
+     * maxiter          maximum iteration threshold
+     * realParts        array which receives real parts of roots, roots are sorted by real part then imaginary part
+     * imaginaryParts   array which receives imaginary parts of roots, zero for real roots
+     * verbose          show process {0: no, 1: yes}
+     * state            is answer found or not, will set value of state to 0 if the expression is not a polynomial
+     *                  of degree at most maxDegree, it has no roots or the roots didn't converge in maxiter iterations
+     *
+     * RETURN:          number of roots written in arrays, which is degree of the polynomial
+     *
+     */
+
+    // check maxDegree to be more than zero
+    if (maxDegree <= 0) {
+        printf("\nError: argument maxDegree must be more than zero!\n");
+        Exit(EXIT_FAILURE);
+    } // end of maxDegree check
+
+    // initializing variables
+    double *coefficients = (double *) malloc((maxDegree + 1) * sizeof(double));
+
+    if (coefficients == NULL) {
+        printf("Unable to allocate memory!\n");
+        Exit(EXIT_FAILURE);
+    } // end of if
+
+    int degree = polynomialCoefficients_1_arg(expression, coefficients, maxDegree);
+
+    // other root finders must be used for this expression
+    if (degree < 0) {
+        if (verbose) {
+            printf("\nThe expression is not a polynomial of degree at most %u.\n\n", maxDegree);
+        } // end if(verbose)
+
+        free(coefficients);
+        *state = 0;
+        return 0;
+    } // end of if
+
+    unsigned int count = polynomialRootsCoefficients(coefficients, (unsigned int) degree, ete, ere, maxiter,
+                                                     realParts, imaginaryParts, verbose, state);
+
+    free(coefficients);
+    return count;
+} // end of polynomialRoots function
+
+
+unsigned int polynomialRootsCoefficients(const double *coefficients, unsigned int degree, double ete, double ere,
+                                         unsigned int maxiter, double *realParts, double *imaginaryParts,
+                                         int verbose, int *state) {
+    /*
+     * Aberth-Ehrlich method for the polynomial c[0] + c[1] * x + ... + c[degree] * x^degree,
+     * other arguments are the same as polynomialRoots function.
+     */
+
+    // check error thresholds
+    if (ere < 0 || ete < 0) {
+        printf("\nError: ete or ere argument is not valid.\n");
+        Exit(EXIT_FAILURE);
+    } // end of if
+
+    // check maxiter to be more than zero
+    if (maxiter <= 0) {
+        printf("\nError: argument maxiter must be more than zero!\n");
+        Exit(EXIT_FAILURE);
+    } // end of maxiter check
+
+    // check verbose
+    if (verbose != 0 && verbose != 1) {
+        printf("\nError: verbose argument is not valid.\n");
+        Exit(EXIT_FAILURE);
+    } // end of if
+
+    // remove zero leading coefficients
+    while (degree > 0 && coefficients[degree] == 0) {
+        --degree;
+    }
+
+    // a constant has no roots
+    if (degree == 0) {
+        if (verbose) {
+            printf("\nThe polynomial is constant, so it has no roots.\n\n");
+        } // end if(verbose)
+
+        *state = 0;
+        return 0;
+    } // end of if
+
+    // x = 0 is a root as many times as the lowest coefficients are zero
+    unsigned int zeros = 0;
+    while (coefficients[zeros] == 0) {
+        realParts[zeros] = 0;
+        imaginaryParts[zeros] = 0;
+        ++zeros;
+    } // end of while loop
+
+    // p(x) = (x^zeros) * q(x), where q has no zero roots
+    const double *q = coefficients + zeros;
+    const unsigned int n = degree - zeros;
+
+    if (n == 1) {
+        // linear polynomial doesn't need iterations
+        realParts[zeros] = -q[0] / q[1];
+        imaginaryParts[zeros] = 0;
+    } else if (n > 1) {
+        // initializing variables
+        Complex *z = (Complex *) malloc(n * sizeof(Complex));
+        int *converged = (int *) calloc(n, sizeof(int));
+
+        if (z == NULL || converged == NULL) {
+            printf("Unable to allocate memory!\n");
+            Exit(EXIT_FAILURE);
+        } // end of if
+
+        // initial guesses are on a circle with the radius of geometric mean of the roots' sizes,
+        // rotated a bit, so they are not symmetric about real axis
+        const double radius = pow(fabs(q[0] / q[n]), 1.0 / n);
+        const double pi = acos(-1.0);
+        for (unsigned int i = 0; i < n; ++i) {
+            double angle = 2 * pi * i / n + 0.4;
+            z[i].re = radius * cos(angle);
+            z[i].im = radius * sin(angle);
+        } // end of for loop
+
+        unsigned int iter = 1, remaining = n;
+
+        while (remaining > 0 && iter <= maxiter) {
+            double largest = 0;
+
+            for (unsigned int i = 0; i < n; ++i) {
+                if (converged[i]) {
+                    continue;
+                } // end of if
+
+                // evaluate q(z) and q'(z) by Horner's method
+                // and bound of round off error of q(z)
+                const double size = complexAbs(z[i]);
+                Complex p = {q[n], 0}, dp = {0, 0};
+                double bound = fabs(q[n]);
+                for (unsigned int k = n; k-- > 0;) {
+                    dp = complexMul(dp, z[i]);
+                    dp.re += p.re;
+                    dp.im += p.im;
+                    p = complexMul(p, z[i]);
+                    p.re += q[k];
+                    bound = bound * size + fabs(q[k]);
+                } // end of for loop
+
+                // q(z) is zero or it's only round off error, so z can't get better
+                if (complexAbs(p) <= 4 * n * DBL_EPSILON * bound) {
+                    converged[i] = 1;
+                    --remaining;
+                    continue;
+                } // end of if
+
+                // Newton step
+                Complex w;
+                if (dp.re == 0 && dp.im == 0) {
+                    // q'(z) = 0, so move the guess a little
+                    w.re = (1 + complexAbs(z[i])) * DBL_EPSILON * 1024;
+                    w.im = w.re;
+                } else {
+                    Complex ratio = complexDiv(p, dp);
+
+                    // sum of 1 / (z[i] - z[j]) for all other roots
+                    Complex sum = {0, 0};
+                    for (unsigned int j = 0; j < n; ++j) {
+                        if (j != i) {
+                            Complex one = {1, 0};
+                            Complex d = complexDiv(one, complexSub(z[i], z[j]));
+                            sum.re += d.re;
+                            sum.im += d.im;
+                        } // end of if
+                    } // end of for loop
+
+                    // w = ratio / (1 - ratio * sum)
+                    Complex denominator = complexMul(ratio, sum);
+                    denominator.re = 1 - denominator.re;
+                    denominator.im = -denominator.im;
+                    w = complexDiv(ratio, denominator);
+                } // end of if
+
+                // new values are used right away for other roots (Gauss-Seidel style)
+                z[i] = complexSub(z[i], w);
+
+                // check errors
+                double ete_err = complexAbs(w);
+                if (ete_err > largest) {
+                    largest = ete_err;
+                } // end of if
+
+                if (ete_err <= 4 * DBL_EPSILON * complexAbs(z[i]) || (ete != 0 && ete_err < ete) ||
+                    (ere != 0 && ete_err < ere * size)) {
+                    converged[i] = 1;
+                    --remaining;
+                } // end of if
+            } // end of for loop
+
+            if (verbose) {
+                printf("\nIteration number [#%d]: largest correction = %.5e, unconverged roots = %u",
+                       iter, largest, remaining);
+            } // end if(verbose)
+
+            ++iter;
+        } // end of while loop
+
+        if (remaining > 0) {
+            if (verbose) {
+                printf("\n\nThe roots didn't converge in %u iterations.\n\n", maxiter);
+            } // end if(verbose)
+
+            *state = 0;
+        } else if (verbose) {
+            printf("\n\nAll of the roots converged in %u iterations.\n\n", iter - 1);
+        } // end of if
+
+        // tiny imaginary parts are round off errors of real roots
+        for (unsigned int i = 0; i < n; ++i) {
+            double size = complexAbs(z[i]);
+            realParts[zeros + i] = z[i].re;
+            imaginaryParts[zeros + i] = fabs(z[i].im) <= 8 * DBL_EPSILON * size ? 0 : z[i].im;
+        } // end of for loop
+
+        free(z);
+        free(converged);
+    } // end of if
+
+    // sort roots by real part, then imaginary part
+    for (unsigned int i = 1; i < degree; ++i) {
+        double re = realParts[i], im = imaginaryParts[i];
+        unsigned int j = i;
+        while (j > 0 && (realParts[j - 1] > re || (realParts[j - 1] == re && imaginaryParts[j - 1] > im))) {
+            realParts[j] = realParts[j - 1];
+            imaginaryParts[j] = imaginaryParts[j - 1];
+            --j;
+        } // end of while loop
+        realParts[j] = re;
+        imaginaryParts[j] = im;
+    } // end of for loop
+
+    return degree;
+} // end of polynomialRootsCoefficients function
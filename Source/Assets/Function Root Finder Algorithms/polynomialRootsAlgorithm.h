@@ -0,0 +1,36 @@
+#ifndef C_MATH_POLYNOMIALROOTSALGORITHM_H
+#define C_MATH_POLYNOMIALROOTSALGORITHM_H
+
+unsigned int polynomialRoots(const char *expression, unsigned int maxDegree, double ete, double ere,
+                             unsigned int maxiter, double *realParts, double *imaginaryParts, int verbose, int *state);
+/*
+ * If the expression is a polynomial in x, like "(x-1)^3*(x^2+4)", this function finds all of it's real and
+ * complex roots at once by Aberth-Ehrlich method. the method improves all of the roots simultaneously,
+ * every root is corrected by Newton step of p(x) divided by the product of it's distances to the other roots.
+ * each iteration costs O(n^2) and convergence is cubic for simple roots.
+ *
+ * ARGUMENTS:
+ * expressions      the function expression, it must be a pointer to a string array like "x^3-2*x-5"
+ * maxDegree        maximum degree of polynomial, realParts and imaginaryParts must have this size
+ * ete              estimated true error, compared with the last correction of every root
+ * ere              estimated relative error, compared with the last correction of every root divided by it's size
+ * maxiter          maximum iteration threshold
+ * realParts        array which receives real parts of roots, roots are sorted by real part then imaginary part
+ * imaginaryParts   array which receives imaginary parts of roots, zero for real roots
+ * verbose          show process {0: no, 1: yes}
+ * state            is answer found or not, will set value of state to 0 if the expression is not a polynomial
+ *                  of degree at most maxDegree, it has no roots or the roots didn't converge in maxiter iterations
+ *
+ * RETURN:          number of roots written in arrays, which is degree of the polynomial
+ *
+ */
+
+unsigned int polynomialRootsCoefficients(const double *coefficients, unsigned int degree, double ete, double ere,
+                                         unsigned int maxiter, double *realParts, double *imaginaryParts,
+                                         int verbose, int *state);
+/*
+ * Aberth-Ehrlich method for the polynomial c[0] + c[1] * x + ... + c[degree] * x^degree,
+ * other arguments are the same as polynomialRoots function.
+ */
+
+#endif //C_MATH_POLYNOMIALROOTSALGORITHM_H
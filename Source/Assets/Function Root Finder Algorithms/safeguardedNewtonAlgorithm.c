@@ -0,0 +1,236 @@
+#include "safeguardedNewtonAlgorithm.h"
+#include "../Util/functions.h"
+#include "../Util/util.h"
+#include "../Util/_configurations.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <float.h>
+#include <math.h>
+
+double safeguardedNewton(const char *expression, double a, double b, double ete, double ere, double tol,
+                         unsigned int maxiter, int verbose, int *state) {
+    /*
+     * Safeguarded Newton's method is a hybrid of Newton-Raphson method and bisection method. it keeps a bracket [a, b]
+     * which contains the root and takes the Newton step x1 = x0 - f(x0)/f'(x0) only if it stays inside the bracket
+     * and it's size is less than half of the step before the last one, otherwise it bisects the bracket.
+     * so it never diverges or cycles and it doesn't stop when f'(x) = 0, but it converges as fast as Newton's method
+     * near the root.
+     *
+     * ARGUMENTS:
+     * expressions  the function expression, it must be a string array like "x^2+1"
+     * a            starting point of interval [a, b]
+     * b            ending point of interval [a, b]
+     * ete          estimated true error
+     * ere          estimated relative error
+     * tol          tolerance error
+     * maxiter      maximum iteration threshold
+     * verbose      show process {0: no, 1: yes}
+     * state        is answer found or not, will set value of state to 0 if no answers been found
+     *
+     */
+
+    // fix interval reverse
+    if (a > b){
+        double temp = a;
+        a = b;
+        b = temp;
+    } // end of if
+
+    // check interval
+    if (a == b) {
+        printf("\nError: improper interval!\n");
+        Exit(EXIT_FAILURE);
+    } //end of interval check
+
+    // check error thresholds
+    if (ere < 0 || ete < 0 || tol < 0){
+        printf("\nError: ete or ere or tol argument is not valid.\n");
+        Exit(EXIT_FAILURE);
+    } // end of if
+
+    // check maxiter to be more than zero
+    if (maxiter <= 0) {
+        printf("\nError: argument maxiter must be more than zero!\n");
+        Exit(EXIT_FAILURE);
+    } // end of maxiter check
+
+    // check verbose
+    if (verbose != 0 && verbose != 1) {
+        printf("\nError: verbose argument is not valid.\n");
+        Exit(EXIT_FAILURE);
+    } // end of if
+
+    // compile the expression once for all iterations
+    CompiledFunction function;
+    compileFunction_n_arg(&function, expression, 1);
+
+    double x = safeguardedNewtonCompiled(&function, a, b, ete, ere, tol, maxiter, verbose, state);
+
+    freeCompiledFunction(&function);
+    return x;
+} // end of safeguardedNewton function
+
+
+double safeguardedNewtonCompiled(const CompiledFunction *function, double a, double b, double ete, double ere,
+                                 double tol, unsigned int maxiter, int verbose, int *state) {
+    /*
+     * Safeguarded Newton's method on a compiled one argument function, arguments are the same as
+     * safeguardedNewton function but they are not checked again. every thread must use it's own compiled function.
+     */
+
+    // calculates y1 = f(a) and y2 =f(b)
+    double fa = compiledFunction_n_arg(function, &a);
+    double fb = compiledFunction_n_arg(function, &b);
+
+    // if f(a) or f(b) is zero, then it's the root
+    if (fa == 0 || fb == 0) {
+        if (verbose) {
+            printf("\nf(x) = 0 at one end of the interval, so it is the root of function.\n\n");
+        } // end if(verbose)
+
+        return fa == 0 ? a : b;
+    } // end of if
+
+    // if y1 and y2 have same signs, then the bracket doesn't contain a root
+    if (fa * fb > 0) {
+        if (verbose) {
+            printf("Incorrect bracketing of function domain!\n"
+                   "keep in mind that the inequality f(a) * f(b) < 0 must be correct\n"
+                   "in order to use safeguarded Newton's method.\n");
+        }// end if(verbose)
+
+        *state = 0;
+        return -1;
+    } // end of if
+
+    // initializing variables
+    // f(low) < 0 and f(high) > 0, so the root is always between them
+    double low = fa < 0 ? a : b;
+    double high = fa < 0 ? b : a;
+    double x = (a + b) / 2;
+    double dx = b - a, dxOld = dx;
+    double point, fx, dfx, h;
+    double ete_err, ere_err;
+    unsigned int iter = 1;
+    const char *step;
+
+    // calculate function and it's derivative in the given point
+    fx = compiledFunction_n_arg(function, &x);
+    h = DX * (1 + fabs(x));
+    point = x + h;
+    dfx = compiledFunction_n_arg(function, &point);
+    point = x - h;
+    dfx = (dfx - compiledFunction_n_arg(function, &point)) / (2 * h);
+
+    while (iter <= maxiter) {
+        // take Newton step only if it stays inside the bracket and the bracket gets small fast enough,
+        // f'(x) = 0 makes first condition false too
+        if (((x - high) * dfx - fx) * ((x - low) * dfx - fx) > 0 || fabs(2 * fx) > fabs(dxOld * dfx)) {
+            dxOld = dx;
+            dx = (high - low) / 2;
+            x = low + dx;
+            step = "bisection";
+        } else {
+            dxOld = dx;
+            dx = fx / dfx;
+            x -= dx;
+            step = "Newton";
+        } // end of if
+
+        // calculate function and it's derivative in the new point
+        fx = compiledFunction_n_arg(function, &x);
+        h = DX * (1 + fabs(x));
+        point = x + h;
+        dfx = compiledFunction_n_arg(function, &point);
+        point = x - h;
+        dfx = (dfx - compiledFunction_n_arg(function, &point)) / (2 * h);
+
+        if (verbose) {
+            printf("\nIteration number [#%d]: %s step, x%d = %.10e, f(x%d) = %.10e, f'(x%d) = %lf .\n",
+                   iter, step, iter, x, iter, fx, iter, dfx);
+        } // end if(verbose)
+
+        // f(x) is exactly zero
+        if (fx == 0) {
+            if (verbose) {
+                printf("In this iteration, f(x) = 0, so x is the root of function.\n\n");
+            } // end if(verbose)
+
+            return x;
+        } // end of if
+
+        // keep the root inside the bracket
+        if (fx < 0) {
+            low = x;
+        } else {
+            high = x;
+        } // end of if
+
+        if (verbose) {
+            printf("In this iteration, new range is [%lf, %lf].\n", low < high ? low : high,
+                   low < high ? high : low);
+        } // end if(verbose)
+
+        //calculate errors
+        ete_err = fabs(dx);
+        ere_err = fabs(ete_err / x);
+
+        // Termination Criterion
+        // if the bracket can't be smaller, then x is the root
+        if (fabs(high - low) <= 4 * DBL_EPSILON * fabs(x)) {
+            if (verbose) {
+                printf("\nIn this iteration, bracket can't get smaller, so x is the root of function.\n\n");
+            } // end if(verbose)
+
+            return x;
+        } // end of if
+
+        // if calculated error is less than estimated true error threshold
+        if (ete != 0 && ete_err < ete) {
+            if (verbose) {
+                printf("\nIn this iteration, |x%d - x%d| < estimated true error [%.5e < %.5e],\n"
+                       "so x is close enough to the root of function.\n\n", iter, iter - 1, ete_err, ete);
+            } // end if(verbose)
+
+            return x;
+        } // end of estimated true error check
+
+        // if calculated error is less than estimated relative error threshold
+        if (ere != 0 && ere_err < ere) {
+            if (verbose) {
+                printf("\nIn this iteration, |(x%d - x%d / x%d)| < estimated relative error [%.5e < %.5e],\n"
+                       "so x is close enough to the root of function.\n\n", iter, iter - 1, iter, ere_err, ere);
+            } // end if(verbose)
+
+            return x;
+        } // end of estimated relative error check
+
+        // if f(x) is less than tolerance error threshold
+        if (tol != 0 && fabs(fx) < tol) {
+            if (verbose) {
+                printf("\nIn this iteration, |f(x)| < tolerance [%.5e < %.5e],\n"
+                       "so x is close enough to the root of function.\n\n", fabs(fx), tol);
+            } // end if(verbose)
+
+            return x;
+        } // end of tolerance check
+
+        iter++;
+    } // end of while loop
+
+    // answer didn't found
+    if (verbose) {
+        if (ete == 0 && ere == 0 && tol == 0) {
+            printf("\nWith maximum iteration of %d\n", maxiter);
+        } else {
+            printf("\nThe solution does not converge or iterations are not sufficient.\n");
+        } // end of if ... else
+
+        printf("the last calculated x is %lf .\n", x);
+    } // end if(verbose)
+
+    // set state to 0 (false)
+    *state = 0;
+    return x;
+} // end of safeguardedNewtonCompiled function
@@ -0,0 +1,35 @@
+#ifndef C_MATH_SAFEGUARDEDNEWTONALGORITHM_H
+#define C_MATH_SAFEGUARDEDNEWTONALGORITHM_H
+
+#include "../Util/functions.h"
+
+double safeguardedNewton(const char *expression, double a, double b, double ete, double ere, double tol,
+                         unsigned int maxiter, int verbose, int *state);
+/*
+ * Safeguarded Newton's method is a hybrid of Newton-Raphson method and bisection method. it keeps a bracket [a, b]
+ * which contains the root and takes the Newton step x1 = x0 - f(x0)/f'(x0) only if it stays inside the bracket
+ * and it's size is less than half of the step before the last one, otherwise it bisects the bracket.
+ * so it never diverges or cycles and it doesn't stop when f'(x) = 0, but it converges as fast as Newton's method
+ * near the root.
+ *
+ * ARGUMENTS:
+ * expressions  the function expression, it must be a pointer to a string array like "x^2+1"
+ * a            starting point of interval [a, b]
+ * b            ending point of interval [a, b]
+ * ete          estimated true error
+ * ere          estimated relative error
+ * tol          tolerance error
+ * maxiter      maximum iteration threshold
+ * verbose      show process {0: no, 1: yes}
+ * state        is answer found or not, will set value of state to 0 if no answers been found
+ *
+ */
+
+double safeguardedNewtonCompiled(const CompiledFunction *function, double a, double b, double ete, double ere,
+                                 double tol, unsigned int maxiter, int verbose, int *state);
+/*
+ * Safeguarded Newton's method on a compiled one argument function, arguments are the same as
+ * safeguardedNewton function but they are not checked again. every thread must use it's own compiled function.
+ */
+
+#endif //C_MATH_SAFEGUARDEDNEWTONALGORITHM_H
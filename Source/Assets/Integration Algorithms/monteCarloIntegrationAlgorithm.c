@@ -1,12 +1,33 @@
 #include "monteCarloIntegrationAlgorithm.h"
 #include "../Optimization Algorithms/simpleMaxMinFinderAlgorithm.h"
 #include "../Util/randomGenerator.h"
+#include "../Util/quasiRandomGenerator.h"
 #include "../Util/functions.h"
 #include "../Util/util.h"
+#include "../Util/_configurations.h"
 
 #include <stdio.h>
 #include <stdlib.h>
 #include <math.h>
+#include <time.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+static double wallTime(void) {
+    /*
+     * Wall clock time in seconds, unlike clock() it also counts time spent blocked or preempted,
+     * without OpenMP it only has a resolution of one second
+     */
+
+#ifdef _OPENMP
+    return omp_get_wtime();
+#else
+    return difftime(time(NULL), (time_t) 0);
+#endif
+} // end of wallTime
+
 
 double monteCarloIntegration(const char *expression, double a, double b, unsigned int n, unsigned int options,
                              int verbose) {
@@ -21,7 +42,10 @@ double monteCarloIntegration(const char *expression, double a, double b, unsigne
      * a             starting point of interval [a, b]
      * b             ending point of interval [a, b]
      * n             number of sub-intervals to use
-     * options       type of monte carlo to be used {0: random points ,  1: random rectangles}
+     * options       type of monte carlo to be used {0: random points ,  1: random rectangles,
+     *                                                 2: quasi random rectangles (Sobol sequence),
+     *                                                 3: stratified rectangles, 4: antithetic rectangles,
+     *                                                 5: random points with adaptive rectangle}
      * verbose       show process {0: no, 1: yes}
      *
      */
@@ -47,7 +71,7 @@ double monteCarloIntegration(const char *expression, double a, double b, unsigne
     } // end of n check
 
     // check mode and options value
-    if (options != 0 && options != 1){
+    if (options > 5){
         printf("\nError: arguments option or mode are not valid.\n");
         Exit(EXIT_FAILURE);
     } // end of if
@@ -58,12 +82,24 @@ double monteCarloIntegration(const char *expression, double a, double b, unsigne
         Exit(EXIT_FAILURE);
     } // end of if
 
+    // standard error and bound metrics are not returned by this function
+    double standardError;
+    MonteCarloBoundMetrics metrics;
+
     // use requested type of monte carlo integration
     switch (options){
         case 0:
             return monteCarloPointIntegration(expression, a, b, n, verbose);
         case 1:
             return monteCarloRectangleIntegration(expression, a, b, n, verbose);
+        case 2:
+            return quasiMonteCarloHyperRectangleIntegration(expression, 1, &a, &b, n, 0, 0, &standardError, verbose);
+        case 3:
+            return monteCarloStratifiedIntegration(expression, a, b, n, 0, &standardError, verbose);
+        case 4:
+            return monteCarloAntitheticIntegration(expression, a, b, n, &standardError, verbose);
+        case 5:
+            return monteCarloAdaptivePointIntegration(expression, a, b, n, 0, 0, 0, &metrics, verbose);
     } // end of switch
 
     // it shouldn't reach this part, however I wrote a return block
@@ -113,9 +149,11 @@ double monteCarloPointIntegration(const char *expression, double a, double b, un
     } // end of if
 
     // find maximum and minimum of function
-    double *extremum = simpleMaxMinFinder(expression, a, b, n);
+    // the best local extrema of samples are polished, so the rectangle contains the whole function
+    double extremum[2], values[2];
+    maxMinFinder(expression, a, b, n, 4, 0, 0, 100, extremum, values);
     // get values of maximum and minimum
-    double max = function_1_arg(expression, extremum[0]), min = function_1_arg(expression, extremum[1]);
+    double max = values[0], min = values[1];
 
     if (verbose) {
         printf("\nFinding maximum and minimum of this function.\n");
@@ -322,4 +360,1137 @@ double monteCarloRectangleIntegration(const char *expression, double a, double b
     // multiply all heights to width of all rectangles to get area
     area *= width;
     return area;
-} // end of function monteCarloRectangleIntegration
\ No newline at end of file
+} // end of function monteCarloRectangleIntegration
+
+double monteCarloHyperRectangleIntegration(const char *expression, unsigned int dimension, const double *lower,
+                                           const double *upper, unsigned long int n, double *standardError,
+                                           int verbose) {
+    /*
+     * In this method we integrate a function of "dimension" arguments f(x1, x2, ..., xn) over a hyper-rectangle
+     * [lower[0], upper[0]] x [lower[1], upper[1]] x ... by averaging the function on uniformly distributed
+     * random points and multiplying the average by volume of the hyper-rectangle.
+     * random points are generated and evaluated in blocks of BLOCK_SIZE points stored as structure of arrays.
+     *
+     * ARGUMENTS:
+     * expressions   the function expression, it must be a string array like "x1^2+x2^2"
+     * dimension     number of arguments of the function
+     * lower         array of size dimension, starting points of intervals
+     * upper         array of size dimension, ending points of intervals
+     * n             number of random points to use
+     * standardError will be set to the estimated standard error of the result
+     * verbose       show process {0: no, 1: yes}
+     *
+     */
+
+    // check dimension to be more than zero
+    if (dimension <= 0) {
+        printf("\nError: argument dimension must be more than zero!\n");
+        Exit(EXIT_FAILURE);
+    } // end of dimension check
+
+    // check n to be more than one
+    // this is implemented to prevent divide by zero error in variance
+    if (n <= 1) {
+        printf("\nError: argument n must be more than one!\n");
+        Exit(EXIT_FAILURE);
+    } // end of n check
+
+    // check verbose
+    if (verbose != 0 && verbose != 1) {
+        printf("\nError: verbose argument is not valid.\n");
+        Exit(EXIT_FAILURE);
+    } // end of if
+
+    // initializing variables
+    double *start = (double *) malloc(dimension * sizeof(double));
+    double *width = (double *) malloc(dimension * sizeof(double));
+    double *points = (double *) malloc((unsigned long int) dimension * BLOCK_SIZE * sizeof(double));
+    double *values = (double *) malloc(BLOCK_SIZE * sizeof(double));
+    double volume = 1, mean = 0, m2 = 0;
+    unsigned long int done = 0;
+    CompiledFunction function;
+
+    if (start == NULL || width == NULL || points == NULL || values == NULL) {
+        printf("Unable to allocate memory!\n");
+        Exit(EXIT_FAILURE);
+    } // end of if
+
+    for (unsigned int j = 0; j < dimension; ++j) {
+        // fix interval reverse
+        start[j] = lower[j] < upper[j] ? lower[j] : upper[j];
+        width[j] = fabs(upper[j] - lower[j]);
+
+        // check interval
+        if (width[j] == 0) {
+            printf("\nError: improper interval at dimension %u!\n", j + 1);
+            Exit(EXIT_FAILURE);
+        } //end of interval check
+
+        volume *= width[j];
+    } // end of for loop
+
+    if (verbose) {
+        printf("\nVolume of the hyper-rectangle is %lf .\n", volume);
+    } // end if(verbose)
+
+    // compile the expression once for all points
+    compileFunction_n_arg(&function, expression, dimension);
+
+    // set the seed for random number generator
+    seed();
+
+    while (done < n) {
+        unsigned long int count = n - done < BLOCK_SIZE ? n - done : BLOCK_SIZE;
+        double blockMean = 0, blockM2 = 0, delta;
+
+        // generate random points of block, coordinate by coordinate
+        for (unsigned int j = 0; j < dimension; ++j) {
+            double *coordinates = points + (unsigned long int) j * BLOCK_SIZE;
+            for (unsigned long int i = 0; i < count; ++i) {
+                coordinates[i] = start[j] + width[j] * zeroToOneUniformRandom();
+            }
+        } // end of for loop
+
+        // evaluate the function on the whole block
+        compiledFunctionBatch_n_arg(&function, points, count, BLOCK_SIZE, values);
+
+        // mean and sum of squared deviations of the block
+        for (unsigned long int i = 0; i < count; ++i) {
+            blockMean += values[i];
+        }
+        blockMean /= (double) count;
+        for (unsigned long int i = 0; i < count; ++i) {
+            blockM2 += (values[i] - blockMean) * (values[i] - blockMean);
+        }
+
+        // merge block statistics with total statistics (Chan et al. parallel variance)
+        delta = blockMean - mean;
+        mean += delta * (double) count / (double) (done + count);
+        m2 += blockM2 + delta * delta * (double) done * (double) count / (double) (done + count);
+        done += count;
+
+        if (verbose) {
+            printf("Points [#%lu]: mean of f = %lf, estimated integral = %lf .\n", done, mean, volume * mean);
+        } // end if(verbose)
+    } // end of while loop
+
+    freeCompiledFunction(&function);
+    free(start);
+    free(width);
+    free(points);
+    free(values);
+
+    // standard error of the mean multiplied by volume
+    *standardError = volume * sqrt(m2 / (double) (n - 1) / (double) n);
+
+    if (verbose) {
+        printf("\nIntegral = volume * mean of f = %lf * %lf, standard error = %lf .\n", volume, mean,
+               *standardError);
+    } // end if(verbose)
+
+    return volume * mean;
+} // end of function monteCarloHyperRectangleIntegration
+
+
+double quasiMonteCarloHyperRectangleIntegration(const char *expression, unsigned int dimension, const double *lower,
+                                                const double *upper, unsigned long int n, unsigned int sequence,
+                                                unsigned int randomizations, double *standardError, int verbose) {
+    /*
+     * In this method we use the same approach as monteCarloHyperRectangleIntegration but points come from
+     * a low discrepancy sequence (Sobol or Halton) instead of pseudo random numbers, so error decreases
+     * nearly as O(1/n) instead of O(1/sqrt(n)).
+     * to estimate the error, the n points are divided between "randomizations" independent random shifts
+     * of the sequence and standard error is calculated from their results.
+     *
+     * ARGUMENTS:
+     * expressions    the function expression, it must be a string array like "x1^2+x2^2"
+     * dimension      number of arguments of the function
+     * lower          array of size dimension, starting points of intervals
+     * upper          array of size dimension, ending points of intervals
+     * n              total number of points to use, powers of 2 are best for Sobol sequence
+     * sequence       type of low discrepancy sequence {0: Sobol, 1: Halton}
+     * randomizations number of random shifts {0: no shift and no error estimation, 1 or more: shifted sequences}
+     *                standard error can only be estimated with 2 or more randomizations
+     * standardError  will be set to the estimated standard error of the result
+     * verbose        show process {0: no, 1: yes}
+     *
+     */
+
+    // check dimension to be more than zero
+    if (dimension <= 0) {
+        printf("\nError: argument dimension must be more than zero!\n");
+        Exit(EXIT_FAILURE);
+    } // end of dimension check
+
+    // check sequence
+    if (sequence != 0 && sequence != 1) {
+        printf("\nError: sequence argument is not valid.\n");
+        Exit(EXIT_FAILURE);
+    } // end of if
+
+    // check n to be enough for all randomizations
+    if (n <= 0 || n < randomizations) {
+        printf("\nError: argument n must be more than zero and number of randomizations!\n");
+        Exit(EXIT_FAILURE);
+    } // end of n check
+
+    // check verbose
+    if (verbose != 0 && verbose != 1) {
+        printf("\nError: verbose argument is not valid.\n");
+        Exit(EXIT_FAILURE);
+    } // end of if
+
+    // initializing variables
+    unsigned int replicas = randomizations ? randomizations : 1;
+    unsigned long int perReplica = n / replicas;
+    double *start = (double *) malloc(dimension * sizeof(double));
+    double *width = (double *) malloc(dimension * sizeof(double));
+    double *unit = (double *) malloc(dimension * sizeof(double));
+    double *points = (double *) malloc((unsigned long int) dimension * BLOCK_SIZE * sizeof(double));
+    double *values = (double *) malloc(BLOCK_SIZE * sizeof(double));
+    double volume = 1, mean = 0, m2 = 0;
+    SobolSequence sobol;
+    HaltonSequence halton;
+    CompiledFunction function;
+
+    if (start == NULL || width == NULL || unit == NULL || points == NULL || values == NULL) {
+        printf("Unable to allocate memory!\n");
+        Exit(EXIT_FAILURE);
+    } // end of if
+
+    for (unsigned int j = 0; j < dimension; ++j) {
+        // fix interval reverse
+        start[j] = lower[j] < upper[j] ? lower[j] : upper[j];
+        width[j] = fabs(upper[j] - lower[j]);
+
+        // check interval
+        if (width[j] == 0) {
+            printf("\nError: improper interval at dimension %u!\n", j + 1);
+            Exit(EXIT_FAILURE);
+        } //end of interval check
+
+        volume *= width[j];
+    } // end of for loop
+
+    // initialize requested sequence
+    if (sequence == 0) {
+        initSobolSequence(&sobol, dimension);
+    } else {
+        initHaltonSequence(&halton, dimension);
+    } // end of if
+
+    // compile the expression once for all points
+    compileFunction_n_arg(&function, expression, dimension);
+
+    // set the seed for random shifts
+    seed();
+
+    for (unsigned int r = 1; r <= replicas; ++r) {
+        unsigned long int done = 0;
+        double sum = 0, estimate, delta;
+
+        // every replica uses a new random shift of the same sequence
+        if (randomizations) {
+            if (sequence == 0) {
+                shiftSobolSequence(&sobol);
+            } else {
+                shiftHaltonSequence(&halton);
+            } // end of if
+        } // end of if
+
+        while (done < perReplica) {
+            unsigned long int count = perReplica - done < BLOCK_SIZE ? perReplica - done : BLOCK_SIZE;
+
+            // generate points of block and scale them to the hyper-rectangle
+            for (unsigned long int i = 0; i < count; ++i) {
+                if (sequence == 0) {
+                    nextSobolPoint(&sobol, unit);
+                } else {
+                    nextHaltonPoint(&halton, unit);
+                } // end of if
+
+                for (unsigned int j = 0; j < dimension; ++j) {
+                    points[(unsigned long int) j * BLOCK_SIZE + i] = start[j] + width[j] * unit[j];
+                }
+            } // end of for loop
+
+            // evaluate the function on the whole block
+            compiledFunctionBatch_n_arg(&function, points, count, BLOCK_SIZE, values);
+
+            for (unsigned long int i = 0; i < count; ++i) {
+                sum += values[i];
+            }
+            done += count;
+        } // end of while loop
+
+        estimate = volume * sum / (double) perReplica;
+
+        // update mean and variance of replica estimates (Welford)
+        delta = estimate - mean;
+        mean += delta / r;
+        m2 += delta * (estimate - mean);
+
+        if (verbose) {
+            printf("Randomization [#%u]: %lu points, estimated integral = %lf .\n", r, perReplica, estimate);
+        } // end if(verbose)
+    } // end of for loop
+
+    freeCompiledFunction(&function);
+    free(start);
+    free(width);
+    free(unit);
+    free(points);
+    free(values);
+
+    // standard error of the mean of replica estimates
+    *standardError = replicas > 1 ? sqrt(m2 / (replicas - 1) / replicas) : 0;
+
+    if (verbose) {
+        printf("\nIntegral = %lf, standard error = %lf .\n", mean, *standardError);
+    } // end if(verbose)
+
+    return mean;
+} // end of function quasiMonteCarloHyperRectangleIntegration
+
+
+static void updateStatistics(double value, unsigned long int count, double *mean, double *m2) {
+    /*
+     * Welford's online update of mean and sum of squared deviations with the count-th value
+     */
+
+    double delta = value - *mean;
+    *mean += delta / (double) count;
+    *m2 += delta * (value - *mean);
+} // end of updateStatistics
+
+double monteCarloStratifiedIntegration(const char *expression, double a, double b, unsigned long int n,
+                                       unsigned long int strata, double *standardError, int verbose) {
+    /*
+     * In this method interval [a, b] is divided to equal sub-intervals (strata) and the same number of
+     * random points is used in every stratum, so the variance between strata is removed from the result
+     *
+     * ARGUMENTS:
+     * expressions   the function expression, it must be a string array like "x^2+1"
+     * a             starting point of interval [a, b]
+     * b             ending point of interval [a, b]
+     * n             number of random points to use
+     * strata        number of strata, every stratum needs 2 points at least {0: use n / 2 strata}
+     * standardError will be set to the estimated standard error of the result
+     * verbose       show process {0: no, 1: yes}
+     *
+     */
+
+    // fix interval reverse
+    if (a > b){
+        double temp = a;
+        a = b;
+        b = temp;
+    } // end of if
+
+    // check interval
+    if (a == b) {
+        printf("\nError: improper interval!\n");
+        Exit(EXIT_FAILURE);
+    } //end of interval check
+
+    // use the biggest possible number of strata
+    if (strata == 0) {
+        strata = n / 2;
+    } // end of if
+
+    // check n to have 2 points in every stratum
+    // this is implemented to prevent divide by zero error in variance
+    if (strata == 0 || n < 2 * strata) {
+        printf("\nError: argument n must be at least twice the number of strata!\n");
+        Exit(EXIT_FAILURE);
+    } // end of n check
+
+    // check verbose
+    if (verbose != 0 && verbose != 1) {
+        printf("\nError: verbose argument is not valid.\n");
+        Exit(EXIT_FAILURE);
+    } // end of if
+
+    // initializing variables
+    double width = (b - a) / (double) strata, area = 0, variance = 0, x, fx;
+    CompiledFunction function;
+
+    compileFunction_n_arg(&function, expression, 1);
+
+    // set the seed for random number generator
+    seed();
+
+    for (unsigned long int k = 0; k < strata; ++k) {
+        // distribute remaining points between first strata
+        unsigned long int points = n / strata + (k < n % strata ? 1 : 0);
+        double mean = 0, m2 = 0;
+
+        for (unsigned long int i = 1; i <= points; ++i) {
+            x = a + width * ((double) k + zeroToOneUniformRandom());
+            fx = compiledFunction_n_arg(&function, &x);
+            updateStatistics(fx, i, &mean, &m2);
+        } // end of for loop
+
+        // contribution of stratum to area and to variance of area
+        area += width * mean;
+        variance += width * width * m2 / (double) (points - 1) / (double) points;
+
+        if (verbose) {
+            printf("Stratum No. [#%lu]: [%lf, %lf], mean of f = %lf , Total area = %lf .\n",
+                   k + 1, a + width * k, a + width * (k + 1), mean, area);
+        } // end if(verbose)
+    } // end of for loop
+
+    freeCompiledFunction(&function);
+
+    *standardError = sqrt(variance);
+
+    if (verbose) {
+        printf("\nArea = %lf, standard error = %lf .\n", area, *standardError);
+    } // end if(verbose)
+
+    return area;
+} // end of function monteCarloStratifiedIntegration
+
+double monteCarloAntitheticIntegration(const char *expression, double a, double b, unsigned long int n,
+                                       double *standardError, int verbose) {
+    /*
+     * In this method every random point x is used with it's mirror point a + b - x, for monotone functions
+     * f(x) and f(a + b - x) are negatively correlated and the average of them has a lower variance
+     *
+     * ARGUMENTS:
+     * expressions   the function expression, it must be a string array like "x^2+1"
+     * a             starting point of interval [a, b]
+     * b             ending point of interval [a, b]
+     * n             number of function evaluations to use, it makes n / 2 pairs
+     * standardError will be set to the estimated standard error of the result
+     * verbose       show process {0: no, 1: yes}
+     *
+     */
+
+    // fix interval reverse
+    if (a > b){
+        double temp = a;
+        a = b;
+        b = temp;
+    } // end of if
+
+    // check interval
+    if (a == b) {
+        printf("\nError: improper interval!\n");
+        Exit(EXIT_FAILURE);
+    } //end of interval check
+
+    // check n to have 2 pairs at least
+    // this is implemented to prevent divide by zero error in variance
+    if (n < 4) {
+        printf("\nError: argument n must be at least 4!\n");
+        Exit(EXIT_FAILURE);
+    } // end of n check
+
+    // check verbose
+    if (verbose != 0 && verbose != 1) {
+        printf("\nError: verbose argument is not valid.\n");
+        Exit(EXIT_FAILURE);
+    } // end of if
+
+    // initializing variables
+    unsigned long int pairs = n / 2;
+    double width = b - a, mean = 0, m2 = 0, x, mirror, y;
+    CompiledFunction function;
+
+    compileFunction_n_arg(&function, expression, 1);
+
+    // set the seed for random number generator
+    seed();
+
+    for (unsigned long int i = 1; i <= pairs; ++i) {
+        x = a + width * zeroToOneUniformRandom();
+        mirror = a + b - x;
+        y = (compiledFunction_n_arg(&function, &x) + compiledFunction_n_arg(&function, &mirror)) / 2;
+        updateStatistics(y, i, &mean, &m2);
+
+        if (verbose) {
+            printf("Pair No. [#%lu]: (x, a + b - x) = (%lf, %lf) , average of f = %lf .\n", i, x, mirror, y);
+        } // end if(verbose)
+    } // end of for loop
+
+    freeCompiledFunction(&function);
+
+    *standardError = width * sqrt(m2 / (double) (pairs - 1) / (double) pairs);
+
+    if (verbose) {
+        printf("\nArea = width * mean = %lf * %lf, standard error = %lf .\n", width, mean, *standardError);
+    } // end if(verbose)
+
+    return width * mean;
+} // end of function monteCarloAntitheticIntegration
+
+double monteCarloControlVariateIntegration(const char *expression, const char *approximation,
+                                           double approximationIntegral, double a, double b, unsigned long int n,
+                                           double *standardError, int verbose) {
+    /*
+     * In this method an approximation g(x) of f(x) with a known integral on [a, b] is used as control variate,
+     * the integral of f - c * g is estimated by random points and c * integral of g is added back.
+     * c is the optimal coefficient cov(f, g) / var(g) estimated from the same points.
+     *
+     * ARGUMENTS:
+     * expressions          the function expression, it must be a string array like "exp(x)"
+     * approximation        expression of the approximation g(x), it must be a string array like "1+x+x^2/2"
+     * approximationIntegral exact value of integral of g(x) on [a, b]
+     * a                    starting point of interval [a, b]
+     * b                    ending point of interval [a, b]
+     * n                    number of random points to use
+     * standardError        will be set to the estimated standard error of the result
+     * verbose              show process {0: no, 1: yes}
+     *
+     */
+
+    // fix interval reverse
+    if (a > b){
+        double temp = a;
+        a = b;
+        b = temp;
+    } // end of if
+
+    // check interval
+    if (a == b) {
+        printf("\nError: improper interval!\n");
+        Exit(EXIT_FAILURE);
+    } //end of interval check
+
+    // check n to be more than two
+    // this is implemented to prevent divide by zero error in variance
+    if (n <= 2) {
+        printf("\nError: argument n must be more than two!\n");
+        Exit(EXIT_FAILURE);
+    } // end of n check
+
+    // check verbose
+    if (verbose != 0 && verbose != 1) {
+        printf("\nError: verbose argument is not valid.\n");
+        Exit(EXIT_FAILURE);
+    } // end of if
+
+    // initializing variables
+    double width = b - a, x, fx, gx, deltaF, deltaG;
+    double meanF = 0, meanG = 0, cff = 0, cgg = 0, cfg = 0;
+    double c = 0, area, variance;
+    CompiledFunction function, control;
+
+    compileFunction_n_arg(&function, expression, 1);
+    compileFunction_n_arg(&control, approximation, 1);
+
+    // set the seed for random number generator
+    seed();
+
+    for (unsigned long int i = 1; i <= n; ++i) {
+        x = a + width * zeroToOneUniformRandom();
+        fx = compiledFunction_n_arg(&function, &x);
+        gx = compiledFunction_n_arg(&control, &x);
+
+        // online update of means, variances and covariance
+        deltaF = fx - meanF;
+        deltaG = gx - meanG;
+        meanF += deltaF / (double) i;
+        meanG += deltaG / (double) i;
+        cff += deltaF * (fx - meanF);
+        cgg += deltaG * (gx - meanG);
+        cfg += deltaF * (gx - meanG);
+
+        if (verbose) {
+            printf("Point No. [#%lu]: x = %lf , f(x) = %lf , g(x) = %lf .\n", i, x, fx, gx);
+        } // end if(verbose)
+    } // end of for loop
+
+    freeCompiledFunction(&function);
+    freeCompiledFunction(&control);
+
+    // optimal coefficient of control variate
+    if (cgg > 0) {
+        c = cfg / cgg;
+    } // end of if
+
+    area = width * (meanF - c * meanG) + c * approximationIntegral;
+    // variance of f - c * g
+    variance = (cff - 2 * c * cfg + c * c * cgg) / (double) (n - 2);
+    *standardError = width * sqrt((variance > 0 ? variance : 0) / (double) n);
+
+    if (verbose) {
+        printf("\nControl variate coefficient c = cov(f, g) / var(g) = %lf .\n", c);
+        printf("Area = width * (mean of f - c * mean of g) + c * integral of g = %lf, standard error = %lf .\n",
+               area, *standardError);
+    } // end if(verbose)
+
+    return area;
+} // end of function monteCarloControlVariateIntegration
+
+double monteCarloImportanceSamplingIntegration(const char *expression, const char *approximation, double a, double b,
+                                               unsigned long int n, double *standardError, int verbose) {
+    /*
+     * In this method random points are chosen more often where |g(x)| is big, g(x) is an approximation of f(x).
+     * the density p(x) is piecewise constant on BLOCK_SIZE equal cells, proportional to |g| at middle of cells,
+     * mixed with 10% uniform density so no part of [a, b] is left out. the integral is the mean of f(x) / p(x)
+     *
+     * ARGUMENTS:
+     * expressions   the function expression, it must be a string array like "exp(x)"
+     * approximation expression of the approximation g(x), it must be a string array like "1+x+x^2/2"
+     * a             starting point of interval [a, b]
+     * b             ending point of interval [a, b]
+     * n             number of random points to use
+     * standardError will be set to the estimated standard error of the result
+     * verbose       show process {0: no, 1: yes}
+     *
+     */
+
+    // fix interval reverse
+    if (a > b){
+        double temp = a;
+        a = b;
+        b = temp;
+    } // end of if
+
+    // check interval
+    if (a == b) {
+        printf("\nError: improper interval!\n");
+        Exit(EXIT_FAILURE);
+    } //end of interval check
+
+    // check n to be more than one
+    // this is implemented to prevent divide by zero error in variance
+    if (n <= 1) {
+        printf("\nError: argument n must be more than one!\n");
+        Exit(EXIT_FAILURE);
+    } // end of n check
+
+    // check verbose
+    if (verbose != 0 && verbose != 1) {
+        printf("\nError: verbose argument is not valid.\n");
+        Exit(EXIT_FAILURE);
+    } // end of if
+
+    // initializing variables
+    double *cumulative = (double *) malloc((BLOCK_SIZE + 1) * sizeof(double));
+    double cellWidth = (b - a) / BLOCK_SIZE, total = 0, mean = 0, m2 = 0, x, u, weight, density;
+    unsigned int low, high, middle;
+    CompiledFunction function, importance;
+
+    if (cumulative == NULL) {
+        printf("Unable to allocate memory!\n");
+        Exit(EXIT_FAILURE);
+    } // end of if
+
+    compileFunction_n_arg(&function, expression, 1);
+    compileFunction_n_arg(&importance, approximation, 1);
+
+    // cumulative weights of cells
+    cumulative[0] = 0;
+    for (unsigned int k = 0; k < BLOCK_SIZE; ++k) {
+        x = a + cellWidth * (k + 0.5);
+        weight = fabs(compiledFunction_n_arg(&importance, &x));
+        cumulative[k + 1] = cumulative[k] + (isfinite(weight) ? weight : 0);
+    } // end of for loop
+    total = cumulative[BLOCK_SIZE];
+
+    // mix normalized weights with uniform distribution
+    for (unsigned int k = 0; k <= BLOCK_SIZE; ++k) {
+        cumulative[k] = (total > 0 ? 0.9 * cumulative[k] / total : 0) + (total > 0 ? 0.1 : 1.0) * k / BLOCK_SIZE;
+    } // end of for loop
+
+    // set the seed for random number generator
+    seed();
+
+    for (unsigned long int i = 1; i <= n; ++i) {
+        // choose a cell with binary search on cumulative probabilities
+        u = zeroToOneUniformRandom() * cumulative[BLOCK_SIZE];
+        low = 0;
+        high = BLOCK_SIZE - 1;
+        while (low < high) {
+            middle = (low + high) / 2;
+            if (cumulative[middle + 1] <= u) {
+                low = middle + 1;
+            } else {
+                high = middle;
+            }
+        } // end of while loop
+
+        // uniform point inside the cell and it's density
+        x = a + cellWidth * (low + zeroToOneUniformRandom());
+        density = (cumulative[low + 1] - cumulative[low]) / cellWidth;
+        weight = compiledFunction_n_arg(&function, &x) / density;
+        updateStatistics(weight, i, &mean, &m2);
+
+        if (verbose) {
+            printf("Point No. [#%lu]: x = %lf , p(x) = %lf , f(x) / p(x) = %lf .\n", i, x, density, weight);
+        } // end if(verbose)
+    } // end of for loop
+
+    freeCompiledFunction(&function);
+    freeCompiledFunction(&importance);
+    free(cumulative);
+
+    *standardError = sqrt(m2 / (double) (n - 1) / (double) n);
+
+    if (verbose) {
+        printf("\nArea = mean of f(x) / p(x) = %lf, standard error = %lf .\n", mean, *standardError);
+    } // end if(verbose)
+
+    return mean;
+} // end of function monteCarloImportanceSamplingIntegration
+
+
+double monteCarloParallelIntegration(const char *expression, unsigned int dimension, const double *lower,
+                                     const double *upper, unsigned long int n, uint64_t seed, unsigned int threads,
+                                     double *standardError, int verbose) {
+    /*
+     * In this method we use the same approach as monteCarloHyperRectangleIntegration with several threads.
+     * points are divided to chunks of PARALLEL_CHUNK_SIZE points, chunk k uses the k-th independent stream
+     * of a xoshiro256** generator started from seed, and results of chunks are merged in order of chunks,
+     * so the result for a given seed is the same for any number of threads.
+     *
+     * ARGUMENTS:
+     * expressions   the function expression, it must be a string array like "x1^2+x2^2"
+     * dimension     number of arguments of the function
+     * lower         array of size dimension, starting points of intervals
+     * upper         array of size dimension, ending points of intervals
+     * n             number of random points to use
+     * seed          seed of random number generator
+     * threads       number of threads {0: all available threads}
+     * standardError will be set to the estimated standard error of the result
+     * verbose       show process {0: no, 1: yes}
+     *
+     */
+
+    // check dimension to be more than zero
+    if (dimension <= 0) {
+        printf("\nError: argument dimension must be more than zero!\n");
+        Exit(EXIT_FAILURE);
+    } // end of dimension check
+
+    // check n to be more than one
+    // this is implemented to prevent divide by zero error in variance
+    if (n <= 1) {
+        printf("\nError: argument n must be more than one!\n");
+        Exit(EXIT_FAILURE);
+    } // end of n check
+
+    // check verbose
+    if (verbose != 0 && verbose != 1) {
+        printf("\nError: verbose argument is not valid.\n");
+        Exit(EXIT_FAILURE);
+    } // end of if
+
+    // choose number of threads
+#ifdef _OPENMP
+    if (threads == 0) {
+        threads = (unsigned int) omp_get_max_threads();
+    } // end of if
+#else
+    threads = 1;
+#endif
+
+    // initializing variables
+    unsigned long int chunks = (n + PARALLEL_CHUNK_SIZE - 1) / PARALLEL_CHUNK_SIZE;
+    double *start = (double *) malloc(dimension * sizeof(double));
+    double *width = (double *) malloc(dimension * sizeof(double));
+    double *chunkMean = (double *) malloc(chunks * sizeof(double));
+    double *chunkM2 = (double *) malloc(chunks * sizeof(double));
+    CompiledFunction *functions = (CompiledFunction *) malloc(threads * sizeof(CompiledFunction));
+    double volume = 1, mean = 0, m2 = 0;
+    Xoshiro256State base;
+
+    if (start == NULL || width == NULL || chunkMean == NULL || chunkM2 == NULL || functions == NULL) {
+        printf("Unable to allocate memory!\n");
+        Exit(EXIT_FAILURE);
+    } // end of if
+
+    for (unsigned int j = 0; j < dimension; ++j) {
+        // fix interval reverse
+        start[j] = lower[j] < upper[j] ? lower[j] : upper[j];
+        width[j] = fabs(upper[j] - lower[j]);
+
+        // check interval
+        if (width[j] == 0) {
+            printf("\nError: improper interval at dimension %u!\n", j + 1);
+            Exit(EXIT_FAILURE);
+        } //end of interval check
+
+        volume *= width[j];
+    } // end of for loop
+
+    // every thread evaluates it's own copy of the function
+    for (unsigned int t = 0; t < threads; ++t) {
+        compileFunction_n_arg(&functions[t], expression, dimension);
+    }
+
+    seedXoshiro256(&base, seed);
+
+    if (verbose) {
+        printf("\nIntegrating with %u threads and %lu chunks of %d points.\n", threads, chunks, PARALLEL_CHUNK_SIZE);
+    } // end if(verbose)
+
+#ifdef _OPENMP
+#pragma omp parallel num_threads(threads)
+#endif
+    {
+#ifdef _OPENMP
+        unsigned int id = (unsigned int) omp_get_thread_num(), count = (unsigned int) omp_get_num_threads();
+#else
+        unsigned int id = 0, count = 1;
+#endif
+        // every thread works on a contiguous range of chunks
+        unsigned long int first = chunks * id / count, last = chunks * (id + 1) / count;
+        double *points = (double *) malloc((unsigned long int) dimension * BLOCK_SIZE * sizeof(double));
+        double *values = (double *) malloc(BLOCK_SIZE * sizeof(double));
+        Xoshiro256State stream = base;
+        Xoshiro256LanesState generator;
+
+        if (points == NULL || values == NULL) {
+            printf("Unable to allocate memory!\n");
+            Exit(EXIT_FAILURE);
+        } // end of if
+
+        // move to the stream of first chunk
+        for (unsigned long int k = 0; k < first; ++k) {
+            jumpXoshiro256(&stream);
+        }
+
+        for (unsigned long int k = first; k < last; ++k) {
+            unsigned long int chunkStart = k * PARALLEL_CHUNK_SIZE;
+            unsigned long int chunkPoints = n - chunkStart < PARALLEL_CHUNK_SIZE ? n - chunkStart : PARALLEL_CHUNK_SIZE;
+            unsigned long int done = 0;
+            double localMean = 0, localM2 = 0;
+
+            // lanes of chunk are long jumps of it's stream, so they don't overlap streams of other chunks
+            seedXoshiro256Lanes(&generator, &stream);
+            jumpXoshiro256(&stream);
+
+            while (done < chunkPoints) {
+                unsigned long int blockPoints = chunkPoints - done < BLOCK_SIZE ? chunkPoints - done : BLOCK_SIZE;
+                double blockMean = 0, blockM2 = 0, delta;
+
+                // generate random points of block, coordinate by coordinate
+                for (unsigned int j = 0; j < dimension; ++j) {
+                    fillUniform(&generator, points + (unsigned long int) j * BLOCK_SIZE, blockPoints, start[j],
+                                start[j] + width[j]);
+                } // end of for loop
+
+                compiledFunctionBatch_n_arg(&functions[id], points, blockPoints, BLOCK_SIZE, values);
+
+                for (unsigned long int i = 0; i < blockPoints; ++i) {
+                    blockMean += values[i];
+                }
+                blockMean /= (double) blockPoints;
+                for (unsigned long int i = 0; i < blockPoints; ++i) {
+                    blockM2 += (values[i] - blockMean) * (values[i] - blockMean);
+                }
+
+                // merge block statistics with chunk statistics
+                delta = blockMean - localMean;
+                localMean += delta * (double) blockPoints / (double) (done + blockPoints);
+                localM2 += blockM2 + delta * delta * (double) done * (double) blockPoints / (double) (done + blockPoints);
+                done += blockPoints;
+            } // end of while loop
+
+            chunkMean[k] = localMean;
+            chunkM2[k] = localM2;
+        } // end of for loop
+
+        free(points);
+        free(values);
+    } // end of parallel region
+
+    // merge chunk statistics in order of chunks
+    for (unsigned long int k = 0; k < chunks; ++k) {
+        unsigned long int done = k * PARALLEL_CHUNK_SIZE;
+        unsigned long int chunkPoints = n - done < PARALLEL_CHUNK_SIZE ? n - done : PARALLEL_CHUNK_SIZE;
+        double delta = chunkMean[k] - mean;
+
+        mean += delta * (double) chunkPoints / (double) (done + chunkPoints);
+        m2 += chunkM2[k] + delta * delta * (double) done * (double) chunkPoints / (double) (done + chunkPoints);
+    } // end of for loop
+
+    for (unsigned int t = 0; t < threads; ++t) {
+        freeCompiledFunction(&functions[t]);
+    }
+    free(functions);
+    free(start);
+    free(width);
+    free(chunkMean);
+    free(chunkM2);
+
+    // standard error of the mean multiplied by volume
+    *standardError = volume * sqrt(m2 / (double) (n - 1) / (double) n);
+
+    if (verbose) {
+        printf("\nIntegral = volume * mean of f = %lf * %lf, standard error = %lf .\n", volume, mean,
+               *standardError);
+    } // end if(verbose)
+
+    return volume * mean;
+} // end of function monteCarloParallelIntegration
+
+
+double monteCarloAdaptivePointIntegration(const char *expression, double a, double b, unsigned int n,
+                                          unsigned int pilot, double minBound, double maxBound,
+                                          MonteCarloBoundMetrics *metrics, int verbose) {
+    /*
+     * In this method we use the same approach as monteCarloPointIntegration, but the rectangle which surrounds
+     * the function curve is not found by sampling the whole interval. it comes from given bounds or a small pilot
+     * sample, and it grows whenever f(x) of a random point goes beyond it. every point is counted with the
+     * height of the rectangle at the time it was drawn, so points before a growth are still correctly weighted.
+     *
+     * ARGUMENTS:
+     * expressions   the function expression, it must be a string array like "x^2+1"
+     * a             starting point of interval [a, b]
+     * b             ending point of interval [a, b]
+     * n             number of random points to use
+     * pilot         number of pilot points used to find the first rectangle {0: square root of n}
+     * minBound      lower bound of f(x) on [a, b]
+     * maxBound      upper bound of f(x) on [a, b], if minBound >= maxBound a pilot sample is used instead
+     * metrics       will be filled with cost of finding bounds
+     * verbose       show process {0: no, 1: yes}
+     *
+     */
+
+    // fix interval reverse
+    if (a > b){
+        double temp = a;
+        a = b;
+        b = temp;
+    } // end of if
+
+    // check interval
+    if (a == b) {
+        printf("\nError: improper interval!\n");
+        Exit(EXIT_FAILURE);
+    } //end of interval check
+
+    // check n to be more than zero
+    // this is implemented to prevent divide by zero error
+    if (n <= 0) {
+        printf("\nError: argument n must be more than zero!\n");
+        Exit(EXIT_FAILURE);
+    } // end of n check
+
+    // check verbose
+    if (verbose != 0 && verbose != 1) {
+        printf("\nError: verbose argument is not valid.\n");
+        Exit(EXIT_FAILURE);
+    } // end of if
+
+    // initializing variables
+    double width = b - a, x, y, fx, margin, sum = 0;
+    // rectangle always contains x axis, so signed area between curve and x axis can be counted
+    double low = 0, high = 0;
+    CompiledFunction function;
+
+    metrics->pilotEvaluations = 0;
+    metrics->growths = 0;
+    metrics->evaluations = 0;
+
+    compileFunction_n_arg(&function, expression, 1);
+
+    // set the seed for random number generator
+    seed();
+
+    if (minBound < maxBound) {
+        // user knows the bounds
+        low = minBound < 0 ? minBound : 0;
+        high = maxBound > 0 ? maxBound : 0;
+    } else {
+        if (pilot == 0) {
+            pilot = (unsigned int) sqrt((double) n);
+            pilot = pilot < 16 ? 16 : pilot;
+        } // end of if
+
+        // one jittered point in each of pilot equal sub-intervals
+        for (unsigned int i = 0; i < pilot; ++i) {
+            x = a + width * (i + zeroToOneUniformRandom()) / pilot;
+            fx = compiledFunction_n_arg(&function, &x);
+            low = fx < low ? fx : low;
+            high = fx > high ? fx : high;
+        } // end of for loop
+        metrics->pilotEvaluations = pilot;
+
+        // leave a margin for values which pilot has missed
+        margin = 0.05 * (high - low);
+        low = low < 0 ? low - margin : low;
+        high = high > 0 ? high + margin : high;
+    } // end of if
+
+    if (verbose) {
+        printf("\nFirst rectangle is [%lf, %lf] x [%lf, %lf], found with %lu evaluations.\n",
+               a, b, low, high, metrics->pilotEvaluations);
+    } // end if(verbose)
+
+    for (unsigned int i = 1; i <= n; ++i) {
+        x = a + width * zeroToOneUniformRandom();
+        fx = compiledFunction_n_arg(&function, &x);
+
+        // grow the rectangle before choosing y, so this point is drawn from the new rectangle
+        if (fx > high || fx < low) {
+            margin = 0.05 * (high - low);
+            if (fx > high) {
+                high = fx + margin;
+            } else {
+                low = fx - margin;
+            } // end of if
+            metrics->growths++;
+
+            if (verbose) {
+                printf("f(x) = %lf is out of rectangle, new rectangle is [%lf, %lf] x [%lf, %lf].\n",
+                       fx, a, b, low, high);
+            } // end if(verbose)
+        } // end of if
+
+        y = low + (high - low) * zeroToOneUniformRandom();
+
+        // count the point with area of current rectangle
+        if (y > 0 && y <= fx) {
+            sum += high - low;
+        } else if (y < 0 && y >= fx) {
+            sum -= high - low;
+        } // end of if
+
+        if (verbose) {
+            printf("Point No. [#%d]: (x, y) = (%lf, %lf) , f(x) = %lf .\n", i, x, y, fx);
+        } // end if(verbose)
+    } // end of for loop
+
+    freeCompiledFunction(&function);
+    metrics->evaluations = metrics->pilotEvaluations + n;
+
+    if (verbose) {
+        printf("\nRectangle grew %lu times, %lu of %lu evaluations were used to find bounds.\n",
+               metrics->growths, metrics->pilotEvaluations, metrics->evaluations);
+    } // end if(verbose)
+
+    return width * sum / n;
+} // end of function monteCarloAdaptivePointIntegration
+
+
+double monteCarloStreamingIntegration(const char *expression, double a, double b, unsigned long int n,
+                                      unsigned long int chunk, double targetError, double deadline,
+                                      MonteCarloProgress progress, void *context, double *standardError,
+                                      int verbose) {
+    /*
+     * In this method we use the same approach as monteCarloRectangleIntegration, but points are processed
+     * in chunks while mean and variance are updated for every point (Welford). after every chunk the
+     * progress function gets current estimate and it's 95% confidence interval, and integration stops as soon
+     * as standard error reaches targetError, the time limit is over, or progress function asks to stop.
+     *
+     * ARGUMENTS:
+     * expressions   the function expression, it must be a string array like "x^2+1"
+     * a             starting point of interval [a, b]
+     * b             ending point of interval [a, b]
+     * n             maximum number of random points to use
+     * chunk         number of points between two checks {0: BLOCK_SIZE}
+     * targetError   stop when standard error is less than this value {0: no target}
+     * deadline      stop after this many seconds of wall clock time {0: no deadline}
+     * progress      function called after every chunk, return non zero from it to stop {NULL: no function}
+     * context       pointer passed to progress function
+     * standardError will be set to the estimated standard error of the result
+     * verbose       show process {0: no, 1: yes}
+     *
+     */
+
+    // fix interval reverse
+    if (a > b){
+        double temp = a;
+        a = b;
+        b = temp;
+    } // end of if
+
+    // check interval
+    if (a == b) {
+        printf("\nError: improper interval!\n");
+        Exit(EXIT_FAILURE);
+    } //end of interval check
+
+    // check n to be more than one
+    // this is implemented to prevent divide by zero error in variance
+    if (n <= 1) {
+        printf("\nError: argument n must be more than one!\n");
+        Exit(EXIT_FAILURE);
+    } // end of n check
+
+    // check limits
+    if (targetError < 0 || deadline < 0) {
+        printf("\nError: targetError or deadline argument is not valid.\n");
+        Exit(EXIT_FAILURE);
+    } // end of if
+
+    // check verbose
+    if (verbose != 0 && verbose != 1) {
+        printf("\nError: verbose argument is not valid.\n");
+        Exit(EXIT_FAILURE);
+    } // end of if
+
+    // initializing variables
+    double width = b - a, mean = 0, m2 = 0, x, fx, estimate = 0, error = 0;
+    unsigned long int points = 0;
+    const double begin = wallTime();
+    CompiledFunction function;
+
+    if (chunk == 0) {
+        chunk = BLOCK_SIZE;
+    } // end of if
+
+    compileFunction_n_arg(&function, expression, 1);
+
+    // set the seed for random number generator
+    seed();
+
+    while (points < n) {
+        unsigned long int last = n - points < chunk ? n : points + chunk;
+
+        while (points < last) {
+            x = a + width * zeroToOneUniformRandom();
+            fx = compiledFunction_n_arg(&function, &x);
+            updateStatistics(fx, ++points, &mean, &m2);
+        } // end of while loop
+
+        // current estimate and it's standard error
+        estimate = width * mean;
+        error = points > 1 ? width * sqrt(m2 / (double) (points - 1) / (double) points) : 0;
+
+        if (verbose) {
+            printf("Points [#%lu]: area = %lf , standard error = %lf .\n", points, estimate, error);
+        } // end if(verbose)
+
+        // Termination Criterion
+        // if caller does not need more points
+        if (progress != NULL && progress(points, estimate, estimate - 1.96 * error, estimate + 1.96 * error, context)) {
+            if (verbose) {
+                printf("\nProgress function stopped the integration.\n");
+            } // end if(verbose)
+
+            break;
+        } // end of progress check
+
+        // if standard error is less than target error
+        if (targetError != 0 && points > 1 && error < targetError) {
+            if (verbose) {
+                printf("\nstandard error < target error [%.5e < %.5e], so area is accurate enough.\n",
+                       error, targetError);
+            } // end if(verbose)
+
+            break;
+        } // end of target error check
+
+        // if time is over
+        if (deadline != 0 && wallTime() - begin >= deadline) {
+            if (verbose) {
+                printf("\nTime limit of %lf seconds is over.\n", deadline);
+            } // end if(verbose)
+
+            break;
+        } // end of deadline check
+    } // end of while loop
+
+    freeCompiledFunction(&function);
+
+    *standardError = error;
+    return estimate;
+} // end of function monteCarloStreamingIntegration
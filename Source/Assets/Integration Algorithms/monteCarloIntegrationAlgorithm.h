@@ -1,6 +1,17 @@
 #ifndef C_MATH_MONTECARLOINTEGRATIONALGORITHM_H
 #define C_MATH_MONTECARLOINTEGRATIONALGORITHM_H
 
+#include <stdint.h>
+
+typedef struct {
+    unsigned long int pilotEvaluations;
+    unsigned long int growths;
+    unsigned long int evaluations;
+} MonteCarloBoundMetrics;
+
+typedef int (*MonteCarloProgress)(unsigned long int points, double estimate, double lowerConfidence,
+                                  double upperConfidence, void *context);
+
 double monteCarloIntegration(const char *expression, double a, double b, unsigned int n, unsigned int options,
                              int verbose);
 
@@ -15,7 +26,10 @@ double monteCarloIntegration(const char *expression, double a, double b, unsigne
  * a             starting point of interval [a, b]
  * b             ending point of interval [a, b]
  * n             number of sub-intervals to use
- * options       type of monte carlo to be used {0: random points ,  1: random rectangles}
+ * options       type of monte carlo to be used {0: random points ,  1: random rectangles,
+ *                                                 2: quasi random rectangles (Sobol sequence),
+ *                                                 3: stratified rectangles, 4: antithetic rectangles,
+ *                                                 5: random points with adaptive rectangle}
  * verbose       show process {0: no, 1: yes}
  *
  */
@@ -50,4 +64,192 @@ double monteCarloRectangleIntegration(const char *expression, double a, double b
  *
  */
 
+double monteCarloHyperRectangleIntegration(const char *expression, unsigned int dimension, const double *lower,
+                                           const double *upper, unsigned long int n, double *standardError,
+                                           int verbose);
+/*
+ * In this method we integrate a function of "dimension" arguments f(x1, x2, ..., xn) over a hyper-rectangle
+ * [lower[0], upper[0]] x [lower[1], upper[1]] x ... by averaging the function on uniformly distributed
+ * random points and multiplying the average by volume of the hyper-rectangle.
+ * random points are generated and evaluated in blocks of BLOCK_SIZE points stored as structure of arrays.
+ *
+ * ARGUMENTS:
+ * expressions   the function expression, it must be a string array like "x1^2+x2^2"
+ * dimension     number of arguments of the function
+ * lower         array of size dimension, starting points of intervals
+ * upper         array of size dimension, ending points of intervals
+ * n             number of random points to use
+ * standardError will be set to the estimated standard error of the result
+ * verbose       show process {0: no, 1: yes}
+ *
+ */
+
+double quasiMonteCarloHyperRectangleIntegration(const char *expression, unsigned int dimension, const double *lower,
+                                                const double *upper, unsigned long int n, unsigned int sequence,
+                                                unsigned int randomizations, double *standardError, int verbose);
+/*
+ * In this method we use the same approach as monteCarloHyperRectangleIntegration but points come from
+ * a low discrepancy sequence (Sobol or Halton) instead of pseudo random numbers, so error decreases
+ * nearly as O(1/n) instead of O(1/sqrt(n)).
+ * to estimate the error, the n points are divided between "randomizations" independent random shifts
+ * of the sequence and standard error is calculated from their results.
+ *
+ * ARGUMENTS:
+ * expressions    the function expression, it must be a string array like "x1^2+x2^2"
+ * dimension      number of arguments of the function
+ * lower          array of size dimension, starting points of intervals
+ * upper          array of size dimension, ending points of intervals
+ * n              total number of points to use, powers of 2 are best for Sobol sequence
+ * sequence       type of low discrepancy sequence {0: Sobol, 1: Halton}
+ * randomizations number of random shifts {0: no shift and no error estimation, 1 or more: shifted sequences}
+ *                standard error can only be estimated with 2 or more randomizations
+ * standardError  will be set to the estimated standard error of the result
+ * verbose        show process {0: no, 1: yes}
+ *
+ */
+
+double monteCarloStratifiedIntegration(const char *expression, double a, double b, unsigned long int n,
+                                       unsigned long int strata, double *standardError, int verbose);
+/*
+ * In this method interval [a, b] is divided to equal sub-intervals (strata) and the same number of
+ * random points is used in every stratum, so the variance between strata is removed from the result
+ *
+ * ARGUMENTS:
+ * expressions   the function expression, it must be a string array like "x^2+1"
+ * a             starting point of interval [a, b]
+ * b             ending point of interval [a, b]
+ * n             number of random points to use
+ * strata        number of strata, every stratum needs 2 points at least {0: use n / 2 strata}
+ * standardError will be set to the estimated standard error of the result
+ * verbose       show process {0: no, 1: yes}
+ *
+ */
+
+double monteCarloAntitheticIntegration(const char *expression, double a, double b, unsigned long int n,
+                                       double *standardError, int verbose);
+/*
+ * In this method every random point x is used with it's mirror point a + b - x, for monotone functions
+ * f(x) and f(a + b - x) are negatively correlated and the average of them has a lower variance
+ *
+ * ARGUMENTS:
+ * expressions   the function expression, it must be a string array like "x^2+1"
+ * a             starting point of interval [a, b]
+ * b             ending point of interval [a, b]
+ * n             number of function evaluations to use, it makes n / 2 pairs
+ * standardError will be set to the estimated standard error of the result
+ * verbose       show process {0: no, 1: yes}
+ *
+ */
+
+double monteCarloControlVariateIntegration(const char *expression, const char *approximation,
+                                           double approximationIntegral, double a, double b, unsigned long int n,
+                                           double *standardError, int verbose);
+/*
+ * In this method an approximation g(x) of f(x) with a known integral on [a, b] is used as control variate,
+ * the integral of f - c * g is estimated by random points and c * integral of g is added back.
+ * c is the optimal coefficient cov(f, g) / var(g) estimated from the same points.
+ *
+ * ARGUMENTS:
+ * expressions          the function expression, it must be a string array like "exp(x)"
+ * approximation        expression of the approximation g(x), it must be a string array like "1+x+x^2/2"
+ * approximationIntegral exact value of integral of g(x) on [a, b]
+ * a                    starting point of interval [a, b]
+ * b                    ending point of interval [a, b]
+ * n                    number of random points to use
+ * standardError        will be set to the estimated standard error of the result
+ * verbose              show process {0: no, 1: yes}
+ *
+ */
+
+double monteCarloImportanceSamplingIntegration(const char *expression, const char *approximation, double a, double b,
+                                               unsigned long int n, double *standardError, int verbose);
+/*
+ * In this method random points are chosen more often where |g(x)| is big, g(x) is an approximation of f(x).
+ * the density p(x) is piecewise constant on BLOCK_SIZE equal cells, proportional to |g| at middle of cells,
+ * mixed with 10% uniform density so no part of [a, b] is left out. the integral is the mean of f(x) / p(x)
+ *
+ * ARGUMENTS:
+ * expressions   the function expression, it must be a string array like "exp(x)"
+ * approximation expression of the approximation g(x), it must be a string array like "1+x+x^2/2"
+ * a             starting point of interval [a, b]
+ * b             ending point of interval [a, b]
+ * n             number of random points to use
+ * standardError will be set to the estimated standard error of the result
+ * verbose       show process {0: no, 1: yes}
+ *
+ */
+
+double monteCarloParallelIntegration(const char *expression, unsigned int dimension, const double *lower,
+                                     const double *upper, unsigned long int n, uint64_t seed, unsigned int threads,
+                                     double *standardError, int verbose);
+/*
+ * In this method we use the same approach as monteCarloHyperRectangleIntegration with several threads.
+ * points are divided to chunks of PARALLEL_CHUNK_SIZE points, chunk k uses the k-th independent stream
+ * of a xoshiro256** generator started from seed, and results of chunks are merged in order of chunks,
+ * so the result for a given seed is the same for any number of threads.
+ *
+ * ARGUMENTS:
+ * expressions   the function expression, it must be a string array like "x1^2+x2^2"
+ * dimension     number of arguments of the function
+ * lower         array of size dimension, starting points of intervals
+ * upper         array of size dimension, ending points of intervals
+ * n             number of random points to use
+ * seed          seed of random number generator
+ * threads       number of threads {0: all available threads}
+ * standardError will be set to the estimated standard error of the result
+ * verbose       show process {0: no, 1: yes}
+ *
+ */
+
+double monteCarloAdaptivePointIntegration(const char *expression, double a, double b, unsigned int n,
+                                          unsigned int pilot, double minBound, double maxBound,
+                                          MonteCarloBoundMetrics *metrics, int verbose);
+/*
+ * In this method we use the same approach as monteCarloPointIntegration, but the rectangle which surrounds
+ * the function curve is not found by sampling the whole interval. it comes from given bounds or a small pilot
+ * sample, and it grows whenever f(x) of a random point goes beyond it. every point is counted with the
+ * height of the rectangle at the time it was drawn, so points before a growth are still correctly weighted.
+ *
+ * ARGUMENTS:
+ * expressions   the function expression, it must be a string array like "x^2+1"
+ * a             starting point of interval [a, b]
+ * b             ending point of interval [a, b]
+ * n             number of random points to use
+ * pilot         number of pilot points used to find the first rectangle {0: square root of n}
+ * minBound      lower bound of f(x) on [a, b]
+ * maxBound      upper bound of f(x) on [a, b], if minBound >= maxBound a pilot sample is used instead
+ * metrics       will be filled with cost of finding bounds
+ *               pilotEvaluations: evaluations used to find the first rectangle
+ *               growths: number of times the rectangle grew
+ *               evaluations: total number of evaluations
+ * verbose       show process {0: no, 1: yes}
+ *
+ */
+
+double monteCarloStreamingIntegration(const char *expression, double a, double b, unsigned long int n,
+                                      unsigned long int chunk, double targetError, double deadline,
+                                      MonteCarloProgress progress, void *context, double *standardError,
+                                      int verbose);
+/*
+ * In this method we use the same approach as monteCarloRectangleIntegration, but points are processed
+ * in chunks while mean and variance are updated for every point (Welford). after every chunk the
+ * progress function gets current estimate and it's 95% confidence interval, and integration stops as soon
+ * as standard error reaches targetError, the time limit is over, or progress function asks to stop.
+ *
+ * ARGUMENTS:
+ * expressions   the function expression, it must be a string array like "x^2+1"
+ * a             starting point of interval [a, b]
+ * b             ending point of interval [a, b]
+ * n             maximum number of random points to use
+ * chunk         number of points between two checks {0: BLOCK_SIZE}
+ * targetError   stop when standard error is less than this value {0: no target}
+ * deadline      stop after this many seconds of wall clock time, including time spent in progress
+ *               callback {0: no deadline}
+ * progress      function called after every chunk, return non zero from it to stop {NULL: no function}
+ * context       pointer passed to progress function
+ * standardError will be set to the estimated standard error of the result
+ * verbose       show process {0: no, 1: yes}
+ *
+ */
+
 #endif //C_MATH_MONTECARLOINTEGRATIONALGORITHM_H
@@ -0,0 +1,257 @@
+#include "adaptiveGradientAlgorithm.h"
+#include "../Util/functions.h"
+#include "../Util/_configurations.h"
+#include "../Util/util.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+// constants of step policies
+#define ARMIJO_CONSTANT 1e-4
+#define MOMENTUM 0.9
+#define ADAM_BETA1 0.9
+#define ADAM_BETA2 0.999
+#define ADAM_EPSILON 1e-8
+// the steps diverge if both the step and f grow in this many iterations in a row
+#define DIVERGING_STEPS 5
+
+static double derivative(const CompiledFunction *function, double x, double sign) {
+    /*
+     * This function estimates derivative of sign * f at x by central difference, the step is scaled by |x|
+     * so it doesn't vanish when x is large
+     */
+
+    const double h = DX * (1 + fabs(x));
+    double forward = x + h, backward = x - h;
+    return sign * (compiledFunction_n_arg(function, &forward) - compiledFunction_n_arg(function, &backward)) / (2 * h);
+} // end of derivative
+
+
+static double adaptiveGradient(const char *expression, double x0, double ete, double ere, double gamma, int policy,
+                               double sign, unsigned int maxiter, int verbose, int *state, unsigned int *iterations) {
+    /*
+     * This function minimizes sign * f with the selected step policy, so sign = -1 maximizes f,
+     * other arguments are the same as adaptiveGradientDescent function
+     */
+
+    // check error thresholds
+    if (ere < 0 || ete < 0) {
+        printf("\nError: ete or ere arguments are not valid.\n");
+        Exit(EXIT_FAILURE);
+    } // end of if
+
+    // check gamma
+    if (gamma <= 0) {
+        printf("\nError: gamma argument must be more than zero!\n");
+        Exit(EXIT_FAILURE);
+    } // end of if
+
+    // check maxiter to be more than zero
+    if (maxiter <= 0) {
+        printf("\nError: argument maxiter must be more than zero!\n");
+        Exit(EXIT_FAILURE);
+    } // end of maxiter check
+
+    // check verbose and policy
+    if ((verbose != 0 && verbose != 1) || (policy < 0 || policy > 4)) {
+        printf("\nError: either policy or verbose argument is not valid.\n");
+        Exit(EXIT_FAILURE);
+    } // end of if
+
+    // compile the expression once for all iterations
+    CompiledFunction function;
+    compileFunction_n_arg(&function, expression, 1);
+
+    // initializing variables
+    unsigned int iter = 0;
+    double x = x0, past_x, fx = sign * compiledFunction_n_arg(&function, &x), past_fx, fnew, point;
+    double gradient, step = gamma / 2, velocity = 0, m = 0, v = 0, beta1Power = 1, beta2Power = 1;
+    double ete_err, ere_err, past_step = INFINITY;
+    unsigned int growing = 0;
+    int found = 0;
+
+    while (iter < maxiter) {
+        past_x = x;
+        past_fx = fx;
+
+        switch (policy) {
+            case 0:
+                // fixed step
+                x -= gamma * derivative(&function, x, sign);
+                break;
+
+            case 1:
+                // backtracking line search, the step can grow again after it has been reduced
+                gradient = derivative(&function, x, sign);
+                step *= 2;
+                point = x - step * gradient;
+                fnew = sign * compiledFunction_n_arg(&function, &point);
+
+                while (fnew > fx - ARMIJO_CONSTANT * step * gradient * gradient && step * fabs(gradient) > 0) {
+                    step /= 2;
+                    point = x - step * gradient;
+                    fnew = sign * compiledFunction_n_arg(&function, &point);
+                } // end of while loop
+
+                x = point;
+                fx = fnew;
+                break;
+
+            case 2:
+                // heavy-ball momentum
+                velocity = MOMENTUM * velocity - gamma * derivative(&function, x, sign);
+                x += velocity;
+                break;
+
+            case 3:
+                // Nesterov momentum, gradient is evaluated at the look-ahead point
+                velocity = MOMENTUM * velocity - gamma * derivative(&function, x + MOMENTUM * velocity, sign);
+                x += velocity;
+                break;
+
+            default:
+                // adam
+                gradient = derivative(&function, x, sign);
+                m = ADAM_BETA1 * m + (1 - ADAM_BETA1) * gradient;
+                v = ADAM_BETA2 * v + (1 - ADAM_BETA2) * gradient * gradient;
+                beta1Power *= ADAM_BETA1;
+                beta2Power *= ADAM_BETA2;
+                x -= gamma * (m / (1 - beta1Power)) / (sqrt(v / (1 - beta2Power)) + ADAM_EPSILON);
+                break;
+        } // end of switch
+
+        iter++;
+
+        // the step diverged
+        if (!isfinite(x)) {
+            if (verbose) {
+                printf("\nIn this iteration [#%d], x is not a finite number, so the steps diverged.\n", iter);
+            } // end if(verbose)
+
+            x = past_x;
+            break;
+        } // end of if
+
+        // calculate errors
+        ete_err = fabs(past_x - x);
+        ere_err = fabs(ete_err / x);
+
+        // line search has already calculated f(x)
+        if (policy != 1) {
+            fx = sign * compiledFunction_n_arg(&function, &x);
+        } // end of if
+
+        // a damped oscillation of momentum grows f but not the step, so only both of them mean divergence
+        growing = ete_err > past_step && fx > past_fx ? growing + 1 : 0;
+        past_step = ete_err;
+        if (growing >= DIVERGING_STEPS) {
+            if (verbose) {
+                printf("\nIn this iteration [#%d], the step and f(x) have grown in %d iterations in a row,\n"
+                       "so the steps diverged.\n", iter, DIVERGING_STEPS);
+            } // end if(verbose)
+
+            break;
+        } // end of if
+
+        if (verbose) {
+            printf("\nIn this iteration [#%d], x = %.5e f(x) = %.5e\n"
+                   "and estimated true error = %.5e and estimated relative error = %.5e .\n",
+                   iter, x, sign * fx, ete_err, ere_err);
+        } // end if(verbose)
+
+        // Termination Criterion
+        // if calculated error is less than estimated true error threshold
+        if (ete != 0 && ete_err < ete) {
+            if (verbose) {
+                printf("\nIn this iteration the calculated estimated true error is less than the threshold.\n"
+                       "(estimated true error) %.5e < %.5e (threshold).\n"
+                       "so the calculated x is the point on domain that extremum of the function happens.\n",
+                       ete_err, ete);
+            } // end if(verbose)
+
+            found = 1;
+            break;
+        } // end of estimated true error check
+
+        // if calculated error is less than estimated relative error threshold
+        if (ere != 0 && ere_err < ere) {
+            if (verbose) {
+                printf("\nIn this iteration the calculated estimated real error is less than the threshold.\n"
+                       "(estimated real error) %.5e < %.5e (threshold).\n"
+                       "so the calculated x is the point on domain that extremum of the function happens.\n",
+                       ere_err, ere);
+            } // end if(verbose)
+
+            found = 1;
+            break;
+        } // end of estimated relative error check
+    } // end of while loop
+
+    freeCompiledFunction(&function);
+
+    // answer didn't found
+    if (!found) {
+        if (verbose) {
+            if (ete == 0 && ere == 0) {
+                printf("\nWith maximum iteration of %d\n", maxiter);
+            } else {
+                printf("\nThe solution does not converge or iterations are not sufficient.\n");
+            } // end of if ... else
+
+            printf("the last calculated extremum is %lf .\n", x);
+        } // end if(verbose)
+
+        // set state to 0 (false)
+        *state = 0;
+    } // end of if
+
+    if (iterations != NULL) {
+        *iterations = iter;
+    } // end of if
+
+    return x;
+} // end of adaptiveGradient
+
+
+double adaptiveGradientDescent(const char *expression, double x0, double ete, double ere, double gamma, int policy,
+                               unsigned int maxiter, int verbose, int *state, unsigned int *iterations) {
+    /*
+     * Gradient descent with a selectable step policy instead of a fixed learning rate, it finds a local minimum
+     * of the function near x0. the policies are:
+     *
+     * 0: fixed step              x1 = x0 - gamma * f'(x0), the same as gradientDescent function
+     * 1: backtracking line search the step starts from twice the last accepted step (gamma at first) and it's halved
+     *                            until Armijo condition f(x1) <= f(x0) - 1e-4 * step * f'(x0)^2 holds
+     * 2: heavy-ball momentum     v1 = 0.9 * v0 - gamma * f'(x0),  x1 = x0 + v1
+     * 3: Nesterov momentum       v1 = 0.9 * v0 - gamma * f'(x0 + 0.9 * v0),  x1 = x0 + v1
+     * 4: Adam                    moving averages of gradient and it's square (0.9 and 0.999) scale the step,
+     *                            x1 = x0 - gamma * m / (sqrt(v) + 1e-8), with bias correction of m and v
+     *
+     * ARGUMENTS:
+     * expressions  the function expression, it must be a string array like "x^2+1"
+     * x0           starting point
+     * ete          estimated true error
+     * ere          estimated relative error
+     * gamma        step size (also known as learning rate), first step of line search
+     * policy       step policy {0: fixed, 1: line search, 2: momentum, 3: nesterov, 4: adam}
+     * maxiter      maximum iteration threshold
+     * verbose      show process {0: no, 1: yes}
+     * state        is answer found or not
+     * iterations   if it's not NULL, receives number of iterations
+     *
+     */
+
+    return adaptiveGradient(expression, x0, ete, ere, gamma, policy, 1, maxiter, verbose, state, iterations);
+} // end of adaptiveGradientDescent function
+
+
+double adaptiveGradientAscent(const char *expression, double x0, double ete, double ere, double gamma, int policy,
+                              unsigned int maxiter, int verbose, int *state, unsigned int *iterations) {
+    /*
+     * Gradient ascent with a selectable step policy, it finds a local maximum of the function near x0,
+     * arguments are the same as adaptiveGradientDescent function.
+     */
+
+    return adaptiveGradient(expression, x0, ete, ere, gamma, policy, -1, maxiter, verbose, state, iterations);
+} // end of adaptiveGradientAscent function
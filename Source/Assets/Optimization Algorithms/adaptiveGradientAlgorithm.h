@@ -0,0 +1,41 @@
+#ifndef C_MATH_ADAPTIVEGRADIENTALGORITHM_H
+#define C_MATH_ADAPTIVEGRADIENTALGORITHM_H
+
+double adaptiveGradientDescent(const char *expression, double x0, double ete, double ere, double gamma, int policy,
+                               unsigned int maxiter, int verbose, int *state, unsigned int *iterations);
+/*
+ * Gradient descent with a selectable step policy instead of a fixed learning rate, it finds a local minimum
+ * of the function near x0. the policies are:
+ *
+ * 0: fixed step              x1 = x0 - gamma * f'(x0), the same as gradientDescent function
+ * 1: backtracking line search the step starts from twice the last accepted step (gamma at first) and it's halved
+ *                            until Armijo condition f(x1) <= f(x0) - 1e-4 * step * f'(x0)^2 holds
+ * 2: heavy-ball momentum     v1 = 0.9 * v0 - gamma * f'(x0),  x1 = x0 + v1
+ * 3: Nesterov momentum       v1 = 0.9 * v0 - gamma * f'(x0 + 0.9 * v0),  x1 = x0 + v1
+ * 4: Adam                    moving averages of gradient and it's square (0.9 and 0.999) scale the step,
+ *                            x1 = x0 - gamma * m / (sqrt(v) + 1e-8), with bias correction of m and v
+ *
+ * iterations stop as diverged if x is not finite, or if both |x1 - x0| and f(x1) grow in 5 iterations in a row.
+ *
+ * ARGUMENTS:
+ * expressions  the function expression, it must be a string array like "x^2+1"
+ * x0           starting point
+ * ete          estimated true error
+ * ere          estimated relative error
+ * gamma        step size (also known as learning rate), first step of line search
+ * policy       step policy {0: fixed, 1: line search, 2: momentum, 3: nesterov, 4: adam}
+ * maxiter      maximum iteration threshold
+ * verbose      show process {0: no, 1: yes}
+ * state        is answer found or not, will set value of state to 0 if steps diverged or no answers been found
+ * iterations   if it's not NULL, receives number of iterations
+ *
+ */
+
+double adaptiveGradientAscent(const char *expression, double x0, double ete, double ere, double gamma, int policy,
+                              unsigned int maxiter, int verbose, int *state, unsigned int *iterations);
+/*
+ * Gradient ascent with a selectable step policy, it finds a local maximum of the function near x0,
+ * arguments are the same as adaptiveGradientDescent function.
+ */
+
+#endif //C_MATH_ADAPTIVEGRADIENTALGORITHM_H
@@ -0,0 +1,281 @@
+#include "branchAndBoundAlgorithm.h"
+#include "../Util/functions.h"
+#include "../Util/util.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+// a lipschitz bound uses twice of the largest slope seen, since the slope is only estimated
+#define LIPSCHITZ_SAFETY 2
+
+typedef struct {
+    double a, b;     // the cell is [a, b]
+    double value;    // f at the middle of cell
+    double low;      // lower bound of f on the cell
+} Cell;
+
+
+static void evaluateCells(const CompiledFunction *functions, int threads, Cell *cells, long int count, int interval) {
+    /*
+     * This function evaluates f at the middle of cells and bounds f on the cells by interval arithmetic,
+     * cells are evaluated in parallel and every thread uses it's own compiled function
+     */
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 16) num_threads(threads)
+#endif
+    for (long int i = 0; i < count; ++i) {
+#ifdef _OPENMP
+        int id = omp_get_thread_num();
+#else
+        int id = 0;
+#endif
+        double middle = cells[i].a + (cells[i].b - cells[i].a) / 2, high;
+
+        cells[i].value = compiledFunction_n_arg(&functions[id], &middle);
+        if (interval) {
+            compiledInterval_n_arg(&functions[id], &cells[i].a, &cells[i].b, &cells[i].low, &high);
+        } // end of if
+    } // end of parallel for loop
+} // end of evaluateCells
+
+
+double branchAndBound(const char *expression, double a, double b, double ete, double tol, unsigned long int maxcells,
+                      int verbose, double *x, double *bound, int *state) {
+    /*
+     * Branch and bound finds the global minimum of f(x) in interval [a, b] with a certificate. it bounds f on a cell
+     * by interval arithmetic, which gives a lower bound of f on the whole cell, and evaluates f at the middle of
+     * cell, which may improve the best value found (incumbent). a cell whose lower bound is more than incumbent can't
+     * contain the global minimum and is discarded, and every remaining cell is bisected. so the global minimum is
+     * always between the smallest lower bound of remaining cells and incumbent, and it's inside the remaining cells.
+     * cells of a step are evaluated in parallel. if the expression has a function without an interval rule, the
+     * lower bounds come from a lipschitz constant estimated by the slopes seen so far, which is not certified.
+     *
+     * ARGUMENTS:
+     * expressions  the function expression, it must be a string array like "sin(10*x)*x^2"
+     * a            starting point of interval [a, b]
+     * b            ending point of interval [a, b]
+     * ete          estimated true error, compared with width of the remaining cells
+     * tol          tolerance error, compared with difference of incumbent and lower bound of the global minimum
+     * maxcells     maximum number of cells to keep
+     * verbose      show process {0: no, 1: yes}
+     * x            receives the point of global minimum
+     * bound        receives the lower bound of global minimum, or NULL
+     * state        is answer found or not, will set value of state to 0 if more than maxcells cells are needed
+     *
+     * RETURN:      value of function at the global minimum
+     *
+     */
+
+    // check interval
+    if (!(a <= b) || !isfinite(a) || !isfinite(b)) {
+        printf("\nError: [a, b] is not a proper interval!\n");
+        Exit(EXIT_FAILURE);
+    } // end of if
+
+    // check error thresholds
+    if (ete < 0 || tol < 0 || (ete == 0 && tol == 0)) {
+        printf("\nError: ete or tol argument is not valid, at least one of them must be more than zero.\n");
+        Exit(EXIT_FAILURE);
+    } // end of if
+
+    // check maxcells
+    if (maxcells < 2) {
+        printf("\nError: argument maxcells must be at least 2!\n");
+        Exit(EXIT_FAILURE);
+    } // end of maxcells check
+
+    // check verbose
+    if (verbose != 0 && verbose != 1) {
+        printf("\nError: verbose argument is not valid.\n");
+        Exit(EXIT_FAILURE);
+    } // end of if
+
+    // initializing variables
+    int threads = 1;
+#ifdef _OPENMP
+    threads = omp_get_max_threads();
+#endif
+    unsigned long int capacity = 1024 < maxcells ? 1024 : maxcells;
+    Cell *cells = (Cell *) malloc(capacity * sizeof(Cell)), *children = (Cell *) malloc(capacity * sizeof(Cell));
+    CompiledFunction *functions = (CompiledFunction *) malloc(threads * sizeof(CompiledFunction));
+
+    if (cells == NULL || children == NULL || functions == NULL) {
+        printf("Unable to allocate memory!\n");
+        Exit(EXIT_FAILURE);
+    } // end of if
+
+    double fa, fb, fbest, lowest, gap, high, width = b - a, lipschitz = 0;
+    unsigned long int count = 1, evaluations = 3;
+    unsigned int step = 1;
+    int found = 0, interval;
+
+    // every thread evaluates it's own copy of the function
+    for (int t = 0; t < threads; ++t) {
+        compileFunction_n_arg(&functions[t], expression, 1);
+    } // end of for loop
+
+    // end points of interval and the first cell
+    fa = compiledFunction_n_arg(&functions[0], &a);
+    fb = compiledFunction_n_arg(&functions[0], &b);
+    *x = fb < fa || isnan(fa) ? b : a;
+    fbest = fb < fa || isnan(fa) ? fb : fa;
+
+    cells[0].a = a;
+    cells[0].b = b;
+    interval = compiledInterval_n_arg(&functions[0], &a, &b, &cells[0].low, &high);
+    evaluateCells(functions, threads, cells, 1, interval);
+    if (cells[0].value < fbest || isnan(fbest)) {
+        *x = a + (b - a) / 2;
+        fbest = cells[0].value;
+    } // end of if
+
+    if (!interval) {
+        // without an interval rule, the slopes between middle and end points start the lipschitz constant
+        lipschitz = b > a ? fmax(fabs(cells[0].value - fa), fabs(fb - cells[0].value)) / ((b - a) / 2) : 0;
+        cells[0].low = cells[0].value - LIPSCHITZ_SAFETY * lipschitz * (b - a) / 2;
+
+        if (verbose) {
+            printf("\nThe function has no interval rule, lower bounds are estimated by a lipschitz constant\n"
+                   "so the answer is not certified.\n");
+        } // end if(verbose)
+    } // end of if
+
+    while (1) {
+        // the global minimum is between the smallest lower bound and incumbent
+        lowest = INFINITY;
+        for (unsigned long int i = 0; i < count; ++i) {
+            lowest = fmin(lowest, cells[i].low);
+        } // end of for loop
+        lowest = fmin(lowest, fbest);
+        gap = fbest - lowest;
+
+        if (verbose) {
+            printf("\nIn this step [#%d], %lu cells of width %.5e remain, f(incumbent) = %.10e\n"
+                   "and lower bound of global minimum = %.10e .\n", step, count, width, fbest, lowest);
+        } // end if(verbose)
+
+        // Termination Criterion
+        // if incumbent is close enough to lower bound of the global minimum
+        if (tol != 0 && gap <= tol) {
+            if (verbose) {
+                printf("\nIn this step the difference of incumbent and lower bound is less than tolerance error.\n"
+                       "(difference) %.5e <= %.5e (threshold).\n", gap, tol);
+            } // end if(verbose)
+
+            found = 1;
+            break;
+        } // end of tolerance check
+
+        // if cells are smaller than estimated true error threshold
+        if (ete != 0 && width < ete) {
+            if (verbose) {
+                printf("\nIn this step the width of cells is less than estimated true error.\n"
+                       "(width of cells) %.5e < %.5e (threshold).\n", width, ete);
+            } // end if(verbose)
+
+            found = 1;
+            break;
+        } // end of estimated true error check
+
+        // bisection must fit in maxcells
+        if (2 * count > maxcells) {
+            break;
+        } // end of maxcells check
+
+        if (2 * count > capacity) {
+            capacity = 2 * count;
+            cells = (Cell *) realloc(cells, capacity * sizeof(Cell));
+            children = (Cell *) realloc(children, capacity * sizeof(Cell));
+
+            if (cells == NULL || children == NULL) {
+                printf("Unable to allocate memory!\n");
+                Exit(EXIT_FAILURE);
+            } // end of if
+        } // end of if
+
+        // bisect all cells, a child can't have a lower bound less than it's parent
+        for (unsigned long int i = 0; i < count; ++i) {
+            const double middle = cells[i].a + (cells[i].b - cells[i].a) / 2;
+
+            children[2 * i].a = cells[i].a;
+            children[2 * i].b = middle;
+            children[2 * i + 1].a = middle;
+            children[2 * i + 1].b = cells[i].b;
+        } // end of for loop
+
+        evaluateCells(functions, threads, children, (long int) (2 * count), interval);
+        evaluations += 2 * count;
+
+        if (!interval) {
+            // slopes between middle of children and middle of parent
+            for (unsigned long int i = 0; i < 2 * count; ++i) {
+                const double half = (children[i].b - children[i].a) / 2;
+                const double slope = fabs(children[i].value - cells[i / 2].value) / half;
+                if (isfinite(slope)) {
+                    lipschitz = fmax(lipschitz, slope);
+                } // end of if
+            } // end of for loop
+        } // end of if
+
+        for (unsigned long int i = 0; i < 2 * count; ++i) {
+            if (!interval) {
+                // a cell where f is not defined at the middle is discarded, like an empty interval
+                const double half = (children[i].b - children[i].a) / 2;
+                children[i].low = isnan(children[i].value) ? INFINITY :
+                                  children[i].value - LIPSCHITZ_SAFETY * lipschitz * half;
+            } // end of if
+            children[i].low = fmax(children[i].low, cells[i / 2].low);
+
+            if (children[i].value < fbest || isnan(fbest)) {
+                *x = children[i].a + (children[i].b - children[i].a) / 2;
+                fbest = children[i].value;
+            } // end of if
+        } // end of for loop
+
+        // discard cells which can't contain the global minimum
+        const unsigned long int total = 2 * count;
+        count = 0;
+        for (unsigned long int i = 0; i < total; ++i) {
+            if (!(children[i].low > fbest)) {
+                cells[count++] = children[i];
+            } // end of if
+        } // end of for loop
+
+        width /= 2;
+        step++;
+    } // end of while loop
+
+    for (int t = 0; t < threads; ++t) {
+        freeCompiledFunction(&functions[t]);
+    } // end of for loop
+    free(functions);
+    free(cells);
+    free(children);
+
+    if (bound != NULL) {
+        *bound = lowest;
+    } // end of if
+
+    // answer didn't found
+    if (!found) {
+        if (verbose) {
+            printf("\nMore than %lu cells are needed, the best calculated minimum is %lf\n"
+                   "and the global minimum is at least %lf .\n", maxcells, fbest, lowest);
+        } // end if(verbose)
+
+        // set state to 0 (false)
+        *state = 0;
+    } // end of if
+
+    if (verbose) {
+        printf("\nNumber of function evaluations = %lu .\n", evaluations);
+    } // end if(verbose)
+
+    return fbest;
+} // end of branchAndBound function
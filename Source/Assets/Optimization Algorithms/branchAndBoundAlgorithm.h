@@ -0,0 +1,31 @@
+#ifndef C_MATH_BRANCHANDBOUNDALGORITHM_H
+#define C_MATH_BRANCHANDBOUNDALGORITHM_H
+
+double branchAndBound(const char *expression, double a, double b, double ete, double tol, unsigned long int maxcells,
+                      int verbose, double *x, double *bound, int *state);
+/*
+ * Branch and bound finds the global minimum of f(x) in interval [a, b] with a certificate. it bounds f on a cell
+ * by interval arithmetic, which gives a lower bound of f on the whole cell, and evaluates f at the middle of
+ * cell, which may improve the best value found (incumbent). a cell whose lower bound is more than incumbent can't
+ * contain the global minimum and is discarded, and every remaining cell is bisected. so the global minimum is
+ * always between the smallest lower bound of remaining cells and incumbent, and it's inside the remaining cells.
+ * cells of a step are evaluated in parallel. if the expression has a function without an interval rule, the
+ * lower bounds come from a lipschitz constant estimated by the slopes seen so far, which is not certified.
+ *
+ * ARGUMENTS:
+ * expressions  the function expression, it must be a string array like "sin(10*x)*x^2"
+ * a            starting point of interval [a, b]
+ * b            ending point of interval [a, b]
+ * ete          estimated true error, compared with width of the remaining cells
+ * tol          tolerance error, compared with difference of incumbent and lower bound of the global minimum
+ * maxcells     maximum number of cells to keep
+ * verbose      show process {0: no, 1: yes}
+ * x            receives the point of global minimum
+ * bound        receives the lower bound of global minimum, or NULL
+ * state        is answer found or not, will set value of state to 0 if more than maxcells cells are needed
+ *
+ * RETURN:      value of function at the global minimum
+ *
+ */
+
+#endif //C_MATH_BRANCHANDBOUNDALGORITHM_H
@@ -0,0 +1,239 @@
+#include "brentMinimizerAlgorithm.h"
+#include "../Util/functions.h"
+#include "../Util/util.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <float.h>
+#include <math.h>
+
+double brentMinimizer(const char *expression, double a, double b, double ete, double ere, unsigned int maxiter,
+                      int maximize, int verbose, int *state) {
+    /*
+     * Brent's method for minimization combines golden-section search with successive parabolic interpolation.
+     * it fits a parabola through the three best points found so far and jumps to it's vertex when the vertex lies
+     * inside the interval and the step is less than half of the step before the last one, otherwise it takes
+     * a golden-section step. so it's never slower than golden-section search, but near a smooth extremum it converges
+     * superlinearly. every iteration needs only one evaluation of function and no derivatives.
+     *
+     * ARGUMENTS:
+     * expressions  the function expression, it must be a string array like "x^2+1"
+     * a            starting point of interval [a, b]
+     * b            ending point of interval [a, b]
+     * ete          estimated true error, compared with half width of the current interval
+     * ere          estimated relative error
+     * maxiter      maximum iteration threshold
+     * maximize     find maximum instead of minimum {0: no, 1: yes}
+     * verbose      show process {0: no, 1: yes}
+     * state        is answer found or not, will set value of state to 0 if no answers been found
+     *
+     */
+
+    // fix interval reverse
+    if (a > b) {
+        double temp = a;
+        a = b;
+        b = temp;
+    } // end of if
+
+    // check interval
+    if (a == b) {
+        printf("\nError: improper interval!\n");
+        Exit(EXIT_FAILURE);
+    } //end of interval check
+
+    // check error thresholds
+    if (ere < 0 || ete < 0) {
+        printf("\nError: ete or ere arguments are not valid.\n");
+        Exit(EXIT_FAILURE);
+    } // end of if
+
+    // check maxiter to be more than zero
+    if (maxiter <= 0) {
+        printf("\nError: argument maxiter must be more than zero!\n");
+        Exit(EXIT_FAILURE);
+    } // end of maxiter check
+
+    // check verbose and maximize
+    if ((verbose != 0 && verbose != 1) || (maximize != 0 && maximize != 1)) {
+        printf("\nError: either maximize or verbose argument is not valid.\n");
+        Exit(EXIT_FAILURE);
+    } // end of if
+
+    // compile the expression once for all iterations
+    CompiledFunction function;
+    compileFunction_n_arg(&function, expression, 1);
+
+    double x = brentMinimizerCompiled(&function, a, b, ete, ere, maxiter, maximize, verbose, state, NULL);
+
+    freeCompiledFunction(&function);
+    return x;
+} // end of brentMinimizer function
+
+
+double brentMinimizerCompiled(const CompiledFunction *function, double a, double b, double ete, double ere,
+                              unsigned int maxiter, int maximize, int verbose, int *state, double *value) {
+    /*
+     * Brent's method for minimization on a compiled one argument function, arguments are the same as brentMinimizer
+     * function but they are not checked again, if value is not NULL, it receives f(x) of the returned x.
+     * every thread must use it's own compiled function.
+     */
+
+    // initializing variables
+    // maximum of f is minimum of -f
+    const double sign = maximize ? -1 : 1;
+    // square of 1 / golden ratio
+    const double golden = (3 - sqrt(5.0)) / 2;
+    // x is the best point, w is the second best point and v is the previous value of w
+    double x = a + golden * (b - a), w = x, v = x;
+    double fx = sign * compiledFunction_n_arg(function, &x), fw = fx, fv = fx;
+    double u, fu, middle, tolerance, d = 0, e = 0, p, q, r;
+    double ete_err, ere_err;
+    unsigned int iter = 1;
+    const char *step;
+
+    while (iter <= maxiter) {
+        middle = (a + b) / 2;
+        // the smallest step which is meaningful at x
+        tolerance = sqrt(DBL_EPSILON) * fabs(x) + DBL_MIN;
+
+        //calculate errors
+        ete_err = (b - a) / 2;
+        ere_err = fabs(ete_err / x);
+
+        // Termination Criterion
+        // if interval can't be smaller, because function values are not accurate enough
+        if (ete_err <= 2 * tolerance) {
+            if (verbose) {
+                printf("\n\nIn this iteration, interval can't get smaller,\n"
+                       "so x is the point on domain that extremum of the function happens.\n\n");
+            } // end if(verbose)
+
+            break;
+        } // end of if
+
+        // if calculated error is less than estimated true error threshold
+        if (ete != 0 && ete_err < ete) {
+            if (verbose) {
+                printf("\n\nIn this iteration, (b - a) / 2 < estimated true error [%.5e < %.5e],\n"
+                       "so x is the point on domain that extremum of the function happens.\n\n", ete_err, ete);
+            } // end if(verbose)
+
+            break;
+        } // end of estimated true error check
+
+        // if calculated error is less than estimated relative error threshold
+        if (ere != 0 && ere_err < ere) {
+            if (verbose) {
+                printf("\n\nIn this iteration, |(b - a) / 2x| < estimated relative error [%.5e < %.5e],\n"
+                       "so x is the point on domain that extremum of the function happens.\n\n", ere_err, ere);
+            } // end if(verbose)
+
+            break;
+        } // end of estimated relative error check
+
+        if (fabs(e) > tolerance) {
+            // try parabolic interpolation through x, w and v
+            r = (x - w) * (fx - fv);
+            q = (x - v) * (fx - fw);
+            p = (x - v) * q - (x - w) * r;
+            q = 2 * (q - r);
+
+            if (q > 0) {
+                p = -p;
+            } else {
+                q = -q;
+            } // end of if
+
+            r = e;
+            e = d;
+
+            // accept parabolic step only if it falls inside the interval
+            // and it's less than half of the step before the last one
+            if (fabs(p) < fabs(q * r / 2) && p > q * (a - x) && p < q * (b - x)) {
+                d = p / q;
+                u = x + d;
+                step = "parabolic";
+
+                // f must not be evaluated too close to a or b
+                if (u - a < 2 * tolerance || b - u < 2 * tolerance) {
+                    d = x < middle ? tolerance : -tolerance;
+                } // end of if
+            } else {
+                // golden-section step into the larger part of interval
+                e = (x < middle ? b : a) - x;
+                d = golden * e;
+                step = "golden-section";
+            } // end of if
+        } else {
+            // golden-section step into the larger part of interval
+            e = (x < middle ? b : a) - x;
+            d = golden * e;
+            step = "golden-section";
+        } // end of if
+
+        // f must not be evaluated too close to x
+        u = fabs(d) >= tolerance ? x + d : x + (d > 0 ? tolerance : -tolerance);
+        fu = sign * compiledFunction_n_arg(function, &u);
+
+        if (verbose) {
+            printf("\nIteration number [#%d]: %s step, u = %.10e, f(u) = %.10e .", iter, step, u, sign * fu);
+        } // end if(verbose)
+
+        // update interval and the three best points
+        if (fu <= fx) {
+            if (u < x) {
+                b = x;
+            } else {
+                a = x;
+            } // end of if
+
+            v = w;
+            fv = fw;
+            w = x;
+            fw = fx;
+            x = u;
+            fx = fu;
+        } else {
+            if (u < x) {
+                a = u;
+            } else {
+                b = u;
+            } // end of if
+
+            if (fu <= fw || w == x) {
+                v = w;
+                fv = fw;
+                w = u;
+                fw = fu;
+            } else if (fu <= fv || v == x || v == w) {
+                v = u;
+                fv = fu;
+            } // end of if
+        } // end of if
+
+        iter++;
+    } // end of while loop
+
+    // answer didn't found
+    if (iter > maxiter) {
+        if (verbose) {
+            if (ete == 0 && ere == 0) {
+                printf("\n\nWith maximum iteration of %d\n", maxiter);
+            } else {
+                printf("\n\nThe solution does not converge or iterations are not sufficient.\n");
+            } // end of if ... else
+
+            printf("the last calculated extremum is %lf .\n", x);
+        } // end if(verbose)
+
+        // set state to 0 (false)
+        *state = 0;
+    } // end of if
+
+    if (value != NULL) {
+        *value = sign * fx;
+    } // end of if
+
+    return x;
+} // end of brentMinimizerCompiled function
@@ -0,0 +1,36 @@
+#ifndef C_MATH_BRENTMINIMIZERALGORITHM_H
+#define C_MATH_BRENTMINIMIZERALGORITHM_H
+
+#include "../Util/functions.h"
+
+double brentMinimizer(const char *expression, double a, double b, double ete, double ere, unsigned int maxiter,
+                      int maximize, int verbose, int *state);
+/*
+ * Brent's method for minimization combines golden-section search with successive parabolic interpolation.
+ * it fits a parabola through the three best points found so far and jumps to it's vertex when the vertex lies
+ * inside the interval and the step is less than half of the step before the last one, otherwise it takes
+ * a golden-section step. so it's never slower than golden-section search, but near a smooth extremum it converges
+ * superlinearly. every iteration needs only one evaluation of function and no derivatives.
+ *
+ * ARGUMENTS:
+ * expressions  the function expression, it must be a string array like "x^2+1"
+ * a            starting point of interval [a, b]
+ * b            ending point of interval [a, b]
+ * ete          estimated true error, compared with half width of the current interval
+ * ere          estimated relative error
+ * maxiter      maximum iteration threshold
+ * maximize     find maximum instead of minimum {0: no, 1: yes}
+ * verbose      show process {0: no, 1: yes}
+ * state        is answer found or not, will set value of state to 0 if no answers been found
+ *
+ */
+
+double brentMinimizerCompiled(const CompiledFunction *function, double a, double b, double ete, double ere,
+                              unsigned int maxiter, int maximize, int verbose, int *state, double *value);
+/*
+ * Brent's method for minimization on a compiled one argument function, arguments are the same as brentMinimizer
+ * function but they are not checked again, if value is not NULL, it receives f(x) of the returned x.
+ * every thread must use it's own compiled function.
+ */
+
+#endif //C_MATH_BRENTMINIMIZERALGORITHM_H
@@ -0,0 +1,272 @@
+#include "differentialEvolutionAlgorithm.h"
+#include "../Util/functions.h"
+#include "../Util/randomGenerator.h"
+#include "../Util/util.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+
+double differentialEvolution(const char *expression, unsigned int dimension, const double *lower,
+                             const double *upper, unsigned int population, double weight, double crossover,
+                             double ete, double ere, double tol, unsigned long int budget, uint64_t seed, double *x,
+                             int verbose, int *state) {
+    /*
+     * Differential evolution finds the global minimum of f(x1, x2, ..., xn) inside a box. it keeps a population of
+     * points and in every generation it makes a trial point for each member, the trial point mixes the member
+     * and a mutant r1 + weight * (r2 - r3) of three other random members (DE/rand/1/bin), and the trial point
+     * replaces the member if it's not worse. trial points of a generation are evaluated in parallel batches,
+     * and all random numbers come from one generator, so a seed always gives the same result with any number of
+     * threads. it stops when the population converges or the evaluation budget is used.
+     *
+     * ARGUMENTS:
+     * expressions  the function expression with arguments x1, x2, ..., xn like "sin(10*x1)*x1^2",
+     *              "x" can be used for a one argument function
+     * dimension    number of arguments of the function
+     * lower        array of size dimension, lower bounds of arguments
+     * upper        array of size dimension, upper bounds of arguments
+     * population   number of members, at least 4, 10 * dimension is usual
+     * weight       differential weight in (0, 2], 0.8 is usual, or 0 for a random weight in [0.5, 1) in every
+     *              generation (dither)
+     * crossover    crossover probability in [0, 1], 0.9 is usual
+     * ete          estimated true error, compared with the largest width of population along an argument
+     * ere          estimated relative error
+     * tol          tolerance error, compared with difference of function at the worst and the best member
+     * budget       maximum number of function evaluations
+     * seed         seed of random generator
+     * x            array of size dimension, it receives the minimum
+     * verbose      show process {0: no, 1: yes}
+     * state        is answer found or not, will set value of state to 0 if population didn't converge
+     *
+     * RETURN:      value of function at the minimum
+     *
+     */
+
+    // check dimension and population
+    if (dimension == 0 || population < 4) {
+        printf("\nError: dimension must be more than zero and population must be at least 4!\n");
+        Exit(EXIT_FAILURE);
+    } // end of if
+
+    // check weight and crossover
+    if (weight < 0 || weight > 2 || crossover < 0 || crossover > 1) {
+        printf("\nError: weight or crossover argument is not valid.\n");
+        Exit(EXIT_FAILURE);
+    } // end of if
+
+    // check error thresholds
+    if (ere < 0 || ete < 0 || tol < 0) {
+        printf("\nError: ete or ere or tol argument is not valid.\n");
+        Exit(EXIT_FAILURE);
+    } // end of if
+
+    // check budget to be enough for first population
+    if (budget < population) {
+        printf("\nError: budget must be at least the population!\n");
+        Exit(EXIT_FAILURE);
+    } // end of budget check
+
+    // check verbose
+    if (verbose != 0 && verbose != 1) {
+        printf("\nError: verbose argument is not valid.\n");
+        Exit(EXIT_FAILURE);
+    } // end of if
+
+    // check bounds
+    for (unsigned int j = 0; j < dimension; ++j) {
+        if (!(lower[j] <= upper[j]) || !isfinite(lower[j]) || !isfinite(upper[j])) {
+            printf("\nError: bounds of x%u are not a proper interval!\n", j + 1);
+            Exit(EXIT_FAILURE);
+        } // end of if
+    } // end of for loop
+
+    // initializing variables
+    const unsigned int n = dimension, size = population;
+    int threads = 1;
+#ifdef _OPENMP
+    threads = omp_get_max_threads();
+#endif
+    // members and trial points as structure of arrays, and their values
+    double *members = (double *) malloc(2 * ((unsigned long int) n * size + size) * sizeof(double));
+    CompiledFunction *functions = (CompiledFunction *) malloc(threads * sizeof(CompiledFunction));
+
+    if (members == NULL || functions == NULL) {
+        printf("Unable to allocate memory!\n");
+        Exit(EXIT_FAILURE);
+    } // end of if
+
+    double *trials = members + n * size, *values = trials + n * size, *trialValues = values + size;
+    double f, ete_err, ere_err, spread, scale, low, high;
+    unsigned long int evaluations = 0;
+    unsigned int generation = 1, best;
+    int found = 0;
+    Xoshiro256State random;
+
+    // every thread evaluates it's own copy of the function
+    for (int t = 0; t < threads; ++t) {
+        compileFunction_n_arg(&functions[t], expression, n);
+    } // end of for loop
+
+    // first population is uniform in the box
+    seedXoshiro256(&random, seed);
+    for (unsigned int i = 0; i < size; ++i) {
+        for (unsigned int j = 0; j < n; ++j) {
+            members[j * size + i] = lower[j] + (upper[j] - lower[j]) * zeroToOneXoshiro256(&random);
+        } // end of for loop
+    } // end of for loop
+
+    compiledFunctionParallel_n_arg(functions, threads, members, size, values);
+    evaluations += size;
+
+    while (1) {
+        // find the best member, not a number is worse than any number
+        best = 0;
+        for (unsigned int i = 1; i < size; ++i) {
+            if (values[i] < values[best] || isnan(values[best])) {
+                best = i;
+            } // end of if
+        } // end of for loop
+
+        // calculate errors
+        ete_err = 0;
+        scale = 0;
+        spread = 0;
+        for (unsigned int j = 0; j < n; ++j) {
+            low = high = members[j * size];
+            for (unsigned int i = 1; i < size; ++i) {
+                low = fmin(low, members[j * size + i]);
+                high = fmax(high, members[j * size + i]);
+            } // end of for loop
+            ete_err = fmax(ete_err, high - low);
+            scale = fmax(scale, fabs(members[j * size + best]));
+        } // end of for loop
+        for (unsigned int i = 0; i < size; ++i) {
+            spread = fmax(spread, values[i] - values[best]);
+        } // end of for loop
+        ere_err = ete_err / (scale > 0 ? scale : 1);
+
+        if (verbose) {
+            printf("\nIn this generation [#%d], f(best member) = %.10e\n"
+                   "and width of population = %.5e and difference of function on population = %.5e .\n",
+                   generation, values[best], ete_err, spread);
+        } // end if(verbose)
+
+        // Termination Criterion
+        // if calculated error is less than estimated true error threshold
+        if (ete != 0 && ete_err < ete) {
+            if (verbose) {
+                printf("\nIn this generation the width of population is less than estimated true error.\n"
+                       "(width of population) %.5e < %.5e (threshold).\n", ete_err, ete);
+            } // end if(verbose)
+
+            found = 1;
+            break;
+        } // end of estimated true error check
+
+        // if calculated error is less than estimated relative error threshold
+        if (ere != 0 && ere_err < ere) {
+            if (verbose) {
+                printf("\nIn this generation the relative width of population is less than estimated relative error."
+                       "\n(relative width of population) %.5e < %.5e (threshold).\n", ere_err, ere);
+            } // end if(verbose)
+
+            found = 1;
+            break;
+        } // end of estimated relative error check
+
+        // if function has the same value on population
+        if (tol != 0 && spread < tol) {
+            if (verbose) {
+                printf("\nIn this generation the difference of function on population is less than tolerance error."
+                       "\n(difference) %.5e < %.5e (threshold).\n", spread, tol);
+            } // end if(verbose)
+
+            found = 1;
+            break;
+        } // end of tolerance check
+
+        // the next generation must fit in the budget
+        if (evaluations + size > budget) {
+            break;
+        } // end of budget check
+
+        // trial points of generation
+        f = weight > 0 ? weight : 0.5 + 0.5 * zeroToOneXoshiro256(&random);
+        for (unsigned int i = 0; i < size; ++i) {
+            unsigned int r1, r2, r3, jrand = (unsigned int) (zeroToOneXoshiro256(&random) * n);
+
+            // three different members which are not the member itself
+            do {
+                r1 = (unsigned int) (zeroToOneXoshiro256(&random) * size);
+            } while (r1 == i);
+            do {
+                r2 = (unsigned int) (zeroToOneXoshiro256(&random) * size);
+            } while (r2 == i || r2 == r1);
+            do {
+                r3 = (unsigned int) (zeroToOneXoshiro256(&random) * size);
+            } while (r3 == i || r3 == r1 || r3 == r2);
+
+            for (unsigned int j = 0; j < n; ++j) {
+                const double parent = members[j * size + i];
+                double v = parent;
+
+                if (j == jrand || zeroToOneXoshiro256(&random) < crossover) {
+                    v = members[j * size + r1] + f * (members[j * size + r2] - members[j * size + r3]);
+
+                    // a mutant out of box goes back to a random point between parent and the bound
+                    if (v < lower[j]) {
+                        v = lower[j] + (parent - lower[j]) * zeroToOneXoshiro256(&random);
+                    } else if (v > upper[j]) {
+                        v = upper[j] - (upper[j] - parent) * zeroToOneXoshiro256(&random);
+                    } // end of if
+                } // end of if
+
+                trials[j * size + i] = v;
+            } // end of for loop
+        } // end of for loop
+
+        compiledFunctionParallel_n_arg(functions, threads, trials, size, trialValues);
+        evaluations += size;
+
+        // selection
+        for (unsigned int i = 0; i < size; ++i) {
+            if (trialValues[i] <= values[i] || (isnan(values[i]) && !isnan(trialValues[i]))) {
+                for (unsigned int j = 0; j < n; ++j) {
+                    members[j * size + i] = trials[j * size + i];
+                } // end of for loop
+                values[i] = trialValues[i];
+            } // end of if
+        } // end of for loop
+
+        generation++;
+    } // end of while loop
+
+    for (unsigned int j = 0; j < n; ++j) {
+        x[j] = members[j * size + best];
+    } // end of for loop
+    f = values[best];
+
+    for (int t = 0; t < threads; ++t) {
+        freeCompiledFunction(&functions[t]);
+    } // end of for loop
+    free(functions);
+    free(members);
+
+    // answer didn't found
+    if (!found) {
+        if (verbose) {
+            printf("\nThe population does not converge with the budget of %lu evaluations.\n"
+                   "the best calculated minimum is %lf .\n", budget, f);
+        } // end if(verbose)
+
+        // set state to 0 (false)
+        *state = 0;
+    } // end of if
+
+    return f;
+} // end of differentialEvolution function
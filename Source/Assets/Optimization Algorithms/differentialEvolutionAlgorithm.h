@@ -0,0 +1,41 @@
+#ifndef C_MATH_DIFFERENTIALEVOLUTIONALGORITHM_H
+#define C_MATH_DIFFERENTIALEVOLUTIONALGORITHM_H
+
+#include <stdint.h>
+
+double differentialEvolution(const char *expression, unsigned int dimension, const double *lower,
+                             const double *upper, unsigned int population, double weight, double crossover,
+                             double ete, double ere, double tol, unsigned long int budget, uint64_t seed, double *x,
+                             int verbose, int *state);
+/*
+ * Differential evolution finds the global minimum of f(x1, x2, ..., xn) inside a box. it keeps a population of
+ * points and in every generation it makes a trial point for each member, the trial point mixes the member
+ * and a mutant r1 + weight * (r2 - r3) of three other random members (DE/rand/1/bin), and the trial point
+ * replaces the member if it's not worse. trial points of a generation are evaluated in parallel batches,
+ * and all random numbers come from one generator, so a seed always gives the same result with any number of
+ * threads. it stops when the population converges or the evaluation budget is used.
+ *
+ * ARGUMENTS:
+ * expressions  the function expression with arguments x1, x2, ..., xn like "sin(10*x1)*x1^2",
+ *              "x" can be used for a one argument function
+ * dimension    number of arguments of the function
+ * lower        array of size dimension, lower bounds of arguments
+ * upper        array of size dimension, upper bounds of arguments
+ * population   number of members, at least 4, 10 * dimension is usual
+ * weight       differential weight in (0, 2], 0.8 is usual, or 0 for a random weight in [0.5, 1) in every
+ *              generation (dither)
+ * crossover    crossover probability in [0, 1], 0.9 is usual
+ * ete          estimated true error, compared with the largest width of population along an argument
+ * ere          estimated relative error
+ * tol          tolerance error, compared with difference of function at the worst and the best member
+ * budget       maximum number of function evaluations
+ * seed         seed of random generator
+ * x            array of size dimension, it receives the minimum
+ * verbose      show process {0: no, 1: yes}
+ * state        is answer found or not, will set value of state to 0 if population didn't converge
+ *
+ * RETURN:      value of function at the minimum
+ *
+ */
+
+#endif //C_MATH_DIFFERENTIALEVOLUTIONALGORITHM_H
@@ -0,0 +1,160 @@
+#include "goldenSectionSearchAlgorithm.h"
+#include "../Util/functions.h"
+#include "../Util/util.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <float.h>
+#include <math.h>
+
+double goldenSectionSearch(const char *expression, double a, double b, double ete, double ere, unsigned int maxiter,
+                           int maximize, int verbose, int *state) {
+    /*
+     * The golden-section search is a technique for finding an extremum (minimum or maximum) of a function inside
+     * a specified interval. For a strictly unimodal function with an extremum inside the interval, it will find
+     * that extremum. The method operates by successively narrowing the range of values on the specified interval,
+     * it keeps two inner points which divide the interval by the golden ratio, so one of them can be used again
+     * in the next iteration and every iteration needs only one evaluation of function. The interval shrinks
+     * by factor of 0.618 in every iteration.
+     *
+     * ARGUMENTS:
+     * expressions  the function expression, it must be a string array like "x^2+1"
+     * a            starting point of interval [a, b]
+     * b            ending point of interval [a, b]
+     * ete          estimated true error, compared with half width of the current interval
+     * ere          estimated relative error
+     * maxiter      maximum iteration threshold
+     * maximize     find maximum instead of minimum {0: no, 1: yes}
+     * verbose      show process {0: no, 1: yes}
+     * state        is answer found or not, will set value of state to 0 if no answers been found
+     *
+     */
+
+    // fix interval reverse
+    if (a > b) {
+        double temp = a;
+        a = b;
+        b = temp;
+    } // end of if
+
+    // check interval
+    if (a == b) {
+        printf("\nError: improper interval!\n");
+        Exit(EXIT_FAILURE);
+    } //end of interval check
+
+    // check error thresholds
+    if (ere < 0 || ete < 0) {
+        printf("\nError: ete or ere arguments are not valid.\n");
+        Exit(EXIT_FAILURE);
+    } // end of if
+
+    // check maxiter to be more than zero
+    if (maxiter <= 0) {
+        printf("\nError: argument maxiter must be more than zero!\n");
+        Exit(EXIT_FAILURE);
+    } // end of maxiter check
+
+    // check verbose and maximize
+    if ((verbose != 0 && verbose != 1) || (maximize != 0 && maximize != 1)) {
+        printf("\nError: either maximize or verbose argument is not valid.\n");
+        Exit(EXIT_FAILURE);
+    } // end of if
+
+    // compile the expression once for all iterations
+    CompiledFunction function;
+    compileFunction_n_arg(&function, expression, 1);
+
+    // initializing variables
+    // maximum of f is minimum of -f
+    const double sign = maximize ? -1 : 1;
+    // 1 / golden ratio
+    const double ratio = (sqrt(5.0) - 1) / 2;
+    double c = b - ratio * (b - a), d = a + ratio * (b - a);
+    double fc = sign * compiledFunction_n_arg(&function, &c);
+    double fd = sign * compiledFunction_n_arg(&function, &d);
+    double x = c, ete_err, ere_err;
+    unsigned int iter = 1;
+
+    while (iter <= maxiter) {
+        // the extremum is in the part of interval around the better inner point
+        if (fc < fd) {
+            b = d;
+            d = c;
+            fd = fc;
+            c = b - ratio * (b - a);
+            fc = sign * compiledFunction_n_arg(&function, &c);
+        } else {
+            a = c;
+            c = d;
+            fc = fd;
+            d = a + ratio * (b - a);
+            fd = sign * compiledFunction_n_arg(&function, &d);
+        } // end of if
+
+        // the best point found so far
+        x = fc < fd ? c : d;
+
+        // calculate errors
+        ete_err = (b - a) / 2;
+        ere_err = fabs(ete_err / x);
+
+        if (verbose) {
+            printf("\nIteration number [#%d]: interval is [%.10e, %.10e], x = %.10e, f(x) = %.10e .", iter, a, b, x,
+                   sign * (fc < fd ? fc : fd));
+        } // end if(verbose)
+
+        // Termination Criterion
+        // if interval can't be smaller, because function values are not accurate enough
+        if (ete_err <= sqrt(DBL_EPSILON) * fabs(x) + DBL_MIN) {
+            if (verbose) {
+                printf("\n\nIn this iteration, interval can't get smaller,\n"
+                       "so x is the point on domain that extremum of the function happens.\n\n");
+            } // end if(verbose)
+
+            break;
+        } // end of if
+
+        // if calculated error is less than estimated true error threshold
+        if (ete != 0 && ete_err < ete) {
+            if (verbose) {
+                printf("\n\nIn this iteration, (b - a) / 2 < estimated true error [%.5e < %.5e],\n"
+                       "so x is the point on domain that extremum of the function happens.\n\n", ete_err, ete);
+            } // end if(verbose)
+
+            break;
+        } // end of estimated true error check
+
+        // if calculated error is less than estimated relative error threshold
+        if (ere != 0 && ere_err < ere) {
+            if (verbose) {
+                printf("\n\nIn this iteration, |(b - a) / 2x| < estimated relative error [%.5e < %.5e],\n"
+                       "so x is the point on domain that extremum of the function happens.\n\n", ere_err, ere);
+            } // end if(verbose)
+
+            break;
+        } // end of estimated relative error check
+
+        iter++;
+    } // end of while loop
+
+    freeCompiledFunction(&function);
+
+    // answer didn't found
+    if (iter > maxiter) {
+        if (verbose) {
+            if (ete == 0 && ere == 0) {
+                printf("\n\nWith maximum iteration of %d\n", maxiter);
+            } else {
+                printf("\n\nThe solution does not converge or iterations are not sufficient.\n");
+            } // end of if ... else
+
+            printf("the last calculated extremum is %lf .\n", x);
+        } // end if(verbose)
+
+        // set state to 0 (false)
+        *state = 0;
+    } // end of if
+
+    return x;
+} // end of goldenSectionSearch function
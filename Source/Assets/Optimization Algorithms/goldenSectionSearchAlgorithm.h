@@ -0,0 +1,27 @@
+#ifndef C_MATH_GOLDENSECTIONSEARCHALGORITHM_H
+#define C_MATH_GOLDENSECTIONSEARCHALGORITHM_H
+
+double goldenSectionSearch(const char *expression, double a, double b, double ete, double ere, unsigned int maxiter,
+                           int maximize, int verbose, int *state);
+/*
+ * The golden-section search is a technique for finding an extremum (minimum or maximum) of a function inside
+ * a specified interval. For a strictly unimodal function with an extremum inside the interval, it will find
+ * that extremum. The method operates by successively narrowing the range of values on the specified interval,
+ * it keeps two inner points which divide the interval by the golden ratio, so one of them can be used again
+ * in the next iteration and every iteration needs only one evaluation of function. The interval shrinks
+ * by factor of 0.618 in every iteration.
+ *
+ * ARGUMENTS:
+ * expressions  the function expression, it must be a string array like "x^2+1"
+ * a            starting point of interval [a, b]
+ * b            ending point of interval [a, b]
+ * ete          estimated true error, compared with half width of the current interval
+ * ere          estimated relative error
+ * maxiter      maximum iteration threshold
+ * maximize     find maximum instead of minimum {0: no, 1: yes}
+ * verbose      show process {0: no, 1: yes}
+ * state        is answer found or not, will set value of state to 0 if no answers been found
+ *
+ */
+
+#endif //C_MATH_GOLDENSECTIONSEARCHALGORITHM_H
@@ -7,6 +7,15 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <math.h>
+#include <stdint.h>
+#include <time.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+// number of starts which run in parallel before the best result is updated
+#define MULTISTART_ROUND 64
 
 double gradientDescent(const char *expression, double x0, double ete, double ere, double gamma, unsigned int maxiter,
                        int verbose, int *state) {
@@ -164,111 +173,223 @@ double gradientDescentInterval(const char *expression, double a, double b, doubl
         Exit(EXIT_FAILURE);
     } // end of if
 
+    // every call uses it's own random stream without touching the default stream, the clock is mixed with
+    // a counter so calls in the same tick get different streams, and with address of a local variable so
+    // concurrent calls on different threads do too
+    static uint64_t calls = 0;
+    uint64_t call;
+    double minimum;
+
+#ifdef _OPENMP
+#pragma omp atomic capture
+#endif
+    call = ++calls;
+
+    const uint64_t randomSeed = (uint64_t) time(NULL) ^ (uint64_t) clock() << 32 ^ call * 0xD1B54A32D192ED03ull ^
+                                (uint64_t) (uintptr_t) &minimum;
+
+    return gradientDescentMultiStart(expression, a, b, ete, ere, gamma, maxiter, maxiter, randomSeed, &minimum, NULL,
+                                     verbose);
+} // end of gradientDescentInterval function
+
+
+double gradientDescentMultiStart(const char *expression, double a, double b, double ete, double ere, double gamma,
+                                 unsigned int starts, unsigned int maxiter, uint64_t seed, double *minimum,
+                                 unsigned long int *evaluations, int verbose) {
+    /*
+     * This function searches global minimum on an interval [a, b] by gradient descent from many random
+     * starting points. starts are distributed between threads, every thread evaluates it's own copy of the function.
+     * starts run in rounds of MULTISTART_ROUND, a start is stopped as soon as it falls into the neighbourhood of
+     * the best minimum of previous rounds with a higher value, because it can only reach the same minimum.
+     * starting points are generated from the seed before the search and results of a round are merged in order
+     * of starts, so the result and number of evaluations don't depend on number of threads.
+     *
+     * ARGUMENTS:
+     * expressions  the function expression, it must be a string array like "x^2+1"
+     * a            starting point of interval [a, b]
+     * b            ending point of interval [a, b]
+     * ete          estimated true error
+     * ere          estimated relative error
+     * gamma        step size (also known as learning rate)
+     * starts       number of random starting points
+     * maxiter      maximum iteration threshold of every start
+     * seed         seed of random starting points
+     * minimum      receives value of function at the returned point
+     * evaluations  if it's not NULL, receives total number of evaluations of function
+     * verbose      show process {0: no, 1: yes}
+     *
+     * RETURN:      the point on domain that minimum of the function happens
+     *
+     */
+
+    // fix interval reverse
+    if (a > b) {
+        double temp = a;
+        a = b;
+        b = temp;
+    } // end of if
+
+    // check interval
+    if (a == b) {
+        printf("\nError: improper interval!\n");
+        Exit(EXIT_FAILURE);
+    } //end of interval check
+
+    // check error thresholds
+    if (ere < 0 || ete < 0) {
+        printf("\nError: ete or ere arguments are not valid.\n");
+        Exit(EXIT_FAILURE);
+    } // end of if
+
+    // check starts and maxiter to be more than zero
+    if (starts <= 0 || maxiter <= 0) {
+        printf("\nError: arguments starts and maxiter must be more than zero!\n");
+        Exit(EXIT_FAILURE);
+    } // end of maxiter check
+
+    // check verbose
+    if (verbose != 0 && verbose != 1) {
+        printf("\nError: verbose argument is not valid.\n");
+        Exit(EXIT_FAILURE);
+    } // end of if
+
     // initializing variables
-    unsigned int iter = 0, innerIter = 0;
-    // choose an arbitrary result at midpoint between a and b to be updated later
-    double coefficient = (b - a), result = a + coefficient / 2;
-    double x, past_x, fx, fresult;
-    double ete_err, ere_err;
-    double fa = function_1_arg(expression, a);
-    double fb = function_1_arg(expression, b);
+    int threads = 1;
+#ifdef _OPENMP
+    threads = omp_get_max_threads();
+#endif
+    const double coefficient = b - a;
+    // a start which comes this close to the best point with a higher value is pruned
+    const double radius = coefficient / (4.0 * starts) > ete ? coefficient / (4.0 * starts) : ete;
+    // starting points, and the point and value where every start ended (value is nan if it didn't finish)
+    double *points = (double *) malloc(3 * (unsigned long int) starts * sizeof(double));
+    CompiledFunction *functions = (CompiledFunction *) malloc(threads * sizeof(CompiledFunction));
+    unsigned long int count = 0;
+    Xoshiro256State state;
+    Xoshiro256LanesState lanes;
+
+    if (points == NULL || functions == NULL) {
+        printf("Unable to allocate memory!\n");
+        Exit(EXIT_FAILURE);
+    } // end of if
 
-    // set the seed for random number generator
-    seed();
+    double *ends = points + starts, *endValues = ends + starts;
+
+    // choose random starting points
+    seedXoshiro256(&state, seed);
+    seedXoshiro256Lanes(&lanes, &state);
+    fillUniform(&lanes, points, starts, a, b);
+
+    // every thread evaluates it's own copy of the function
+    for (int t = 0; t < threads; ++t) {
+        compileFunction_n_arg(&functions[t], expression, 1);
+    } // end of for loop
+
+    // choose an arbitrary result at midpoint between a and b to be updated later,
+    // a and b are the results of starts which go beyond interval
+    double result = a + coefficient / 2;
+    double fresult = compiledFunction_n_arg(&functions[0], &result);
+    const double fa = compiledFunction_n_arg(&functions[0], &a);
+    const double fb = compiledFunction_n_arg(&functions[0], &b);
+    count += 3;
+
+    for (unsigned int first = 0; first < starts; first += MULTISTART_ROUND) {
+        const long int last = (long int) (starts - first < MULTISTART_ROUND ? starts : first + MULTISTART_ROUND);
+        // starts of this round are only pruned by the best result of previous rounds
+        const double bestX = result, bestF = fresult;
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1) num_threads(threads) reduction(+:count)
+#endif
+        for (long int i = first; i < last; ++i) {
+            int thread = 0;
+#ifdef _OPENMP
+            thread = omp_get_thread_num();
+#endif
+            const CompiledFunction *function = &functions[thread];
+            double x = points[i], past_x, fx = 0;
+            double point, derivative, h;
+            double ete_err, ere_err;
+            unsigned int innerIter = 0;
+            int finished = 0, pruned = 0;
+
+            // go in a loop to find a minimum with random starting point
+            while (innerIter < maxiter && !finished) {
+                // calculate new x by subtracting the derivative of function at x multiplied by gamma from x
+                h = DX;
+                point = x + h;
+                derivative = compiledFunction_n_arg(function, &point);
+                point = x - h;
+                derivative = (derivative - compiledFunction_n_arg(function, &point)) / (2 * h);
+
+                past_x = x;
+                x -= derivative * gamma;
+                fx = compiledFunction_n_arg(function, &x);
+                count += 3;
+
+                // calculate errors
+                ete_err = fabs(past_x - x);
+                ere_err = fabs(ete_err / x);
+
+                // Termination Criterion
+                if (x < a) {
+                    // if new x goes beyond interval lower than a, minimum of the function occurs at a
+                    x = a;
+                    fx = fa;
+                    finished = 1;
+                } else if (x > b) {
+                    // if new x goes beyond interval bigger than b, minimum of the function occurs at b
+                    x = b;
+                    fx = fb;
+                    finished = 1;
+                } else if ((ete != 0 && ete_err < ete) || (ere != 0 && ere_err < ere)) {
+                    // if calculated error is less than estimated true error or estimated relative error threshold
+                    finished = 1;
+                } else if (fabs(x - bestX) < radius && fx >= bestF) {
+                    // it falls into the neighbourhood of the best minimum, so it can't be better
+                    pruned = 1;
+                    break;
+                } // end of if
 
-    while (iter < maxiter) {
-        // try maxiter times to find minimum in given interval [a, b] and return lowest result
-        // update fresult with new result
-        fresult = function_1_arg(expression, result);
-        // choose a random starting point
-        x = a + coefficient * zeroToOneUniformRandom();
-
-        // set inner iter to zero before new loop
-        innerIter = 0;
-        // go in a loop to find a minimum with random starting point
-        while (innerIter < maxiter) {
-            // calculate new x by subtracting the derivative of function at x multiplied by gamma from x
-            past_x = x;
-            x -= firstDerivative_1_arg(expression, x, DX) * gamma;
-            fx = function_1_arg(expression, x);
-
-            // calculate errors
-            ete_err = fabs(past_x - x);
-            ere_err = fabs(ete_err / x);
+                innerIter++;
+            } // end of inner while loop
+
+            ends[i] = x;
+            endValues[i] = finished ? fx : NAN;
 
             if (verbose) {
-                printf("\nIn this iteration [#%d][#%d], x = %.5e f(x) = %.5e\n"
-                       "and estimated true error = %.5e and estimated relative error = %.5e .\n",
-                       iter, innerIter, x, fx, ete_err, ere_err);
+#ifdef _OPENMP
+#pragma omp critical (gradientDescentVerbose)
+#endif
+                printf("\nStart number [#%ld] from x = %.5e: %s after %u iterations, x = %.5e, f(x) = %.5e", i,
+                       points[i], finished ? "finished" : (pruned ? "pruned" : "not converged"), innerIter, x, fx);
             } // end if(verbose)
+        } // end of parallel for loop
 
-            // Termination Criterion
-            // if new x goes beyond interval lower than a
-            if (x < a) {
-                if (verbose) {
-                    printf("\nIn this iteration the calculated x is less than a : %.5e < %f"
-                           "so minimum of the function occurs at a.\n",
-                           x, a);
-                } // end if(verbose)
-
-                // if fa is lower than f(result), then a is where the minimum occurs
-                if (fa < fresult) {
-                    result = a;
-                } // end of if
-                break;
+        // keep the lowest result, an equal value keeps the start with lower index
+        for (long int i = first; i < last; ++i) {
+            if (endValues[i] < fresult) {
+                result = ends[i];
+                fresult = endValues[i];
             } // end of if
+        } // end of for loop
+    } // end of rounds loop
 
-            // if new x goes beyond interval bigger than b
-            if (x > b) {
-                if (verbose) {
-                    printf("\nIn this iteration the calculated x is bigger than b : %.5e > %f"
-                           "so minimum of the function occurs at b.\n",
-                           x, b);
-                } // end if(verbose)
-
-                // if fb is lower than f(result), then b is where the minimum occurs
-                if (fb < fresult) {
-                    result = b;
-                } // end of if
-                break;
-            } // end of if
+    if (verbose) {
+        printf("\n\nThe lowest minimum is f(%.10e) = %.10e, found with %lu evaluations of function.\n",
+               result, fresult, count);
+    } // end if(verbose)
 
-            // if calculated error is less than estimated true error threshold
-            if (ete != 0 && ete_err < ete) {
-                if (verbose) {
-                    printf("\nIn this iteration the calculated estimated true error is less than the threshold.\n"
-                           "(estimated true error) %.5e < %.5e (threshold).\n"
-                           "so the calculated x is the point on domain that minimum of the function happens.\n",
-                           ete_err, ete);
-                } // end if(verbose)
-
-                // if fx is lower than f(result), then x is where the minimum occurs
-                if (fx < fresult) {
-                    result = x;
-                } // end of if
-                break;
-            } // end of estimated true error check
-
-            // if calculated error is less than estimated relative error threshold
-            if (ere != 0 && ere_err < ere) {
-                if (verbose) {
-                    printf("\nIn this iteration the calculated estimated real error is less than the threshold.\n"
-                           "(estimated real error) %.5e < %.5e (threshold).\n"
-                           "so the calculated x is the point on domain that minimum of the function happens.\n",
-                           ere_err, ere);
-                } // end if(verbose)
-
-                // if fx is lower than f(result), then x is where the minimum occurs
-                if (fx < fresult) {
-                    result = x;
-                } // end of if
-                break;
-            } // end of estimated relative error check
-            innerIter++;
-        } // end of inner while loop
-        iter++;
-    } // end of while loop
+    for (int t = 0; t < threads; ++t) {
+        freeCompiledFunction(&functions[t]);
+    } // end of for loop
+    free(functions);
+    free(points);
+
+    *minimum = fresult;
+    if (evaluations != NULL) {
+        *evaluations = count;
+    } // end of if
 
-    // return result
     return result;
-}
\ No newline at end of file
+} // end of gradientDescentMultiStart function
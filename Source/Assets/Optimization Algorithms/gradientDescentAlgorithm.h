@@ -1,6 +1,8 @@
 #ifndef C_MATH_GRADIENTDESCENTALGORITHM_H
 #define C_MATH_GRADIENTDESCENTALGORITHM_H
 
+#include <stdint.h>
+
 double gradientDescent(const char *expression, double x0, double ete, double ere, double gamma, unsigned int maxiter,
                        int verbose, int *state);
 
@@ -28,7 +30,9 @@ double gradientDescentInterval(const char *expression, double a, double b, doubl
  * To find a local minimum of a function using gradient descent, one takes steps proportional to the negative of
  * the gradient (or approximate gradient) of the function at the current point.
  *
- * This function searches minimum on an interval [a, b]
+ * This function searches minimum on an interval [a, b], from maxiter random starting points in parallel,
+ * it's the gradientDescentMultiStart function with a seed from the clock, it doesn't use
+ * the default random stream, so it's safe to call from many threads
  *
  * ARGUMENTS:
  * expressions  the function expression, it must be a string array like "x^2+1"
@@ -42,4 +46,33 @@ double gradientDescentInterval(const char *expression, double a, double b, doubl
  *
  */
 
+double gradientDescentMultiStart(const char *expression, double a, double b, double ete, double ere, double gamma,
+                                 unsigned int starts, unsigned int maxiter, uint64_t seed, double *minimum,
+                                 unsigned long int *evaluations, int verbose);
+/*
+ * This function searches global minimum on an interval [a, b] by gradient descent from many random
+ * starting points. starts are distributed between threads, every thread evaluates it's own copy of the function.
+ * starts run in rounds of MULTISTART_ROUND, a start is stopped as soon as it falls into the neighbourhood of
+ * the best minimum of previous rounds with a higher value, because it can only reach the same minimum.
+ * starting points are generated from the seed before the search and results of a round are merged in order
+ * of starts, so the result and number of evaluations don't depend on number of threads.
+ *
+ * ARGUMENTS:
+ * expressions  the function expression, it must be a string array like "x^2+1"
+ * a            starting point of interval [a, b]
+ * b            ending point of interval [a, b]
+ * ete          estimated true error
+ * ere          estimated relative error
+ * gamma        step size (also known as learning rate)
+ * starts       number of random starting points
+ * maxiter      maximum iteration threshold of every start
+ * seed         seed of random starting points
+ * minimum      receives value of function at the returned point
+ * evaluations  if it's not NULL, receives total number of evaluations of function
+ * verbose      show process {0: no, 1: yes}
+ *
+ * RETURN:      the point on domain that minimum of the function happens
+ *
+ */
+
 #endif //C_MATH_GRADIENTDESCENTALGORITHM_H
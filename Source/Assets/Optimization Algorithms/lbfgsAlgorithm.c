@@ -0,0 +1,578 @@
+#include "lbfgsAlgorithm.h"
+#include "../Util/functions.h"
+#include "../Util/util.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <float.h>
+#include <math.h>
+
+// constants of more-thuente line search
+#define SUFFICIENT_DECREASE 1e-4
+#define CURVATURE 0.9
+#define STEP_TOLERANCE 1e-10
+#define MAXIMUM_STEP 1e20
+#define LINE_SEARCH_EVALUATIONS 20
+
+typedef struct {
+    // correction pairs s = x1 - x0 and y = g1 - g0 in a circular buffer, pair i starts at i * dimension
+    double *s, *y, *rho, *alpha;
+    // gradient, trial gradient, search direction and trial point
+    double *g, *gNew, *d, *xNew;
+} Workspace;
+
+static void step(double *stx, double *fx, double *dx, double *sty, double *fy, double *dy, double *stp, double fp,
+                 double dp, int *bracket, double stpmin, double stpmax) {
+    /*
+     * This function is one step of more-thuente line search (dcstep of MINPACK-2), it computes a safeguarded step
+     * by cubic and quadratic interpolation and updates the interval [stx, sty] which contains the step.
+     * stx is the step with the least function value, f and derivative of f along the direction are
+     * fx, fy and fp, dx, dy and dp.
+     */
+
+    const double sign = dp * (*dx / fabs(*dx));
+    double stpf, stpc, stpq, theta, s, gamma, p, q, r;
+
+    if (fp > *fx) {
+        // higher function value, the minimum is bracketed
+        theta = 3 * (*fx - fp) / (*stp - *stx) + *dx + dp;
+        s = fmax(fabs(theta), fmax(fabs(*dx), fabs(dp)));
+        gamma = s * sqrt((theta / s) * (theta / s) - (*dx / s) * (dp / s));
+        if (*stp < *stx) {
+            gamma = -gamma;
+        } // end of if
+
+        p = (gamma - *dx) + theta;
+        q = ((gamma - *dx) + gamma) + dp;
+        r = p / q;
+        stpc = *stx + r * (*stp - *stx);
+        stpq = *stx + ((*dx / ((*fx - fp) / (*stp - *stx) + *dx)) / 2) * (*stp - *stx);
+        stpf = fabs(stpc - *stx) < fabs(stpq - *stx) ? stpc : stpc + (stpq - stpc) / 2;
+        *bracket = 1;
+    } else if (sign < 0) {
+        // derivatives have opposite sign, the minimum is bracketed
+        theta = 3 * (*fx - fp) / (*stp - *stx) + *dx + dp;
+        s = fmax(fabs(theta), fmax(fabs(*dx), fabs(dp)));
+        gamma = s * sqrt((theta / s) * (theta / s) - (*dx / s) * (dp / s));
+        if (*stp > *stx) {
+            gamma = -gamma;
+        } // end of if
+
+        p = (gamma - dp) + theta;
+        q = ((gamma - dp) + gamma) + *dx;
+        r = p / q;
+        stpc = *stp + r * (*stx - *stp);
+        stpq = *stp + (dp / (dp - *dx)) * (*stx - *stp);
+        stpf = fabs(stpc - *stp) > fabs(stpq - *stp) ? stpc : stpq;
+        *bracket = 1;
+    } else if (fabs(dp) < fabs(*dx)) {
+        // same sign and the magnitude of derivative decreases
+        theta = 3 * (*fx - fp) / (*stp - *stx) + *dx + dp;
+        s = fmax(fabs(theta), fmax(fabs(*dx), fabs(dp)));
+        gamma = s * sqrt(fmax(0, (theta / s) * (theta / s) - (*dx / s) * (dp / s)));
+        if (*stp > *stx) {
+            gamma = -gamma;
+        } // end of if
+
+        p = (gamma - dp) + theta;
+        q = (gamma + (*dx - dp)) + gamma;
+        r = p / q;
+
+        if (r < 0 && gamma != 0) {
+            stpc = *stp + r * (*stx - *stp);
+        } else if (*stp > *stx) {
+            stpc = stpmax;
+        } else {
+            stpc = stpmin;
+        } // end of if
+
+        stpq = *stp + (dp / (dp - *dx)) * (*stx - *stp);
+
+        if (*bracket) {
+            stpf = fabs(stpc - *stp) < fabs(stpq - *stp) ? stpc : stpq;
+            if (*stp > *stx) {
+                stpf = fmin(*stp + 0.66 * (*sty - *stp), stpf);
+            } else {
+                stpf = fmax(*stp + 0.66 * (*sty - *stp), stpf);
+            } // end of if
+        } else {
+            stpf = fabs(stpc - *stp) > fabs(stpq - *stp) ? stpc : stpq;
+            stpf = fmax(stpmin, fmin(stpmax, stpf));
+        } // end of if
+    } else {
+        // same sign and the magnitude of derivative doesn't decrease
+        if (*bracket) {
+            theta = 3 * (fp - *fy) / (*sty - *stp) + *dy + dp;
+            s = fmax(fabs(theta), fmax(fabs(*dy), fabs(dp)));
+            gamma = s * sqrt((theta / s) * (theta / s) - (*dy / s) * (dp / s));
+            if (*stp > *sty) {
+                gamma = -gamma;
+            } // end of if
+
+            p = (gamma - dp) + theta;
+            q = ((gamma - dp) + gamma) + *dy;
+            r = p / q;
+            stpf = *stp + r * (*sty - *stp);
+        } else {
+            stpf = *stp > *stx ? stpmax : stpmin;
+        } // end of if
+    } // end of if
+
+    // update the interval which contains the minimum
+    if (fp > *fx) {
+        *sty = *stp;
+        *fy = fp;
+        *dy = dp;
+    } else {
+        if (sign < 0) {
+            *sty = *stx;
+            *fy = *fx;
+            *dy = *dx;
+        } // end of if
+
+        *stx = *stp;
+        *fx = fp;
+        *dx = dp;
+    } // end of if
+
+    *stp = stpf;
+} // end of step
+
+
+static double evaluate(const CompiledFunction *function, const double *x, const double *d, double stp,
+                       const double *lower, const double *upper, Workspace *work, unsigned long int *evaluations) {
+    /*
+     * This function evaluates f and it's gradient at x + stp * d, the point is kept inside of the box
+     */
+
+    const unsigned int n = function->dimension;
+
+    for (unsigned int i = 0; i < n; ++i) {
+        work->xNew[i] = x[i] + stp * d[i];
+
+        if (lower != NULL && work->xNew[i] < lower[i]) {
+            work->xNew[i] = lower[i];
+        } // end of if
+        if (upper != NULL && work->xNew[i] > upper[i]) {
+            work->xNew[i] = upper[i];
+        } // end of if
+    } // end of for loop
+
+    (*evaluations)++;
+    return compiledGradient_n_arg(function, work->xNew, work->gNew);
+} // end of evaluate
+
+
+static double dot(const double *a, const double *b, unsigned int n) {
+    double sum = 0;
+    for (unsigned int i = 0; i < n; ++i) {
+        sum += a[i] * b[i];
+    }
+    return sum;
+} // end of dot
+
+
+static double lineSearch(const CompiledFunction *function, const double *x, double f, double *stp, double stpmax,
+                         const double *lower, const double *upper, Workspace *work, unsigned long int *evaluations,
+                         int *success) {
+    /*
+     * More-thuente line search (dcsrch of MINPACK-2), it finds a step along d which satisfies strong wolfe
+     * conditions f(x + stp * d) <= f(x) + 1e-4 * stp * g.d and |g(x + stp * d).d| <= 0.9 * |g.d|.
+     * the accepted point and it's gradient are left in xNew and gNew, and f at the point is returned.
+     * if the conditions can't be satisfied, the best point is returned and success is set to 0.
+     */
+
+    const unsigned int n = function->dimension;
+    const double ginit = dot(work->g, work->d, n), gtest = SUFFICIENT_DECREASE * ginit;
+    double width = stpmax, width1 = 2 * width;
+    double stx = 0, fx = f, gx = ginit, sty = 0, fy = f, gy = ginit;
+    double stmin = 0, stmax = *stp + 4 * *stp;
+    double fp = f, dp, ftest, last = 0;
+    int bracket = 0, stage = 1;
+
+    *success = 0;
+
+    for (unsigned int k = 0; k < LINE_SEARCH_EVALUATIONS; ++k) {
+        last = *stp;
+        fp = evaluate(function, x, work->d, last, lower, upper, work, evaluations);
+        dp = dot(work->gNew, work->d, n);
+        ftest = f + *stp * gtest;
+
+        if (stage == 1 && fp <= ftest && dp >= 0) {
+            stage = 2;
+        } // end of if
+
+        // strong wolfe conditions
+        if (fp <= ftest && fabs(dp) <= CURVATURE * -ginit) {
+            *success = 1;
+            return fp;
+        } // end of if
+
+        // step can't be better because of bounds or rounding errors
+        if ((*stp == stpmax && fp <= ftest && dp <= gtest) ||
+            (bracket && (*stp <= stmin || *stp >= stmax || stmax - stmin <= STEP_TOLERANCE * stmax))) {
+            *success = fp <= ftest;
+            break;
+        } // end of if
+
+        // in first stage a modified function is used, which has it's minimum at the sufficient decrease line
+        if (stage == 1 && fp <= fx && fp > ftest) {
+            double fm = fp - *stp * gtest, fxm = fx - stx * gtest, fym = fy - sty * gtest;
+            double gm = dp - gtest, gxm = gx - gtest, gym = gy - gtest;
+
+            step(&stx, &fxm, &gxm, &sty, &fym, &gym, stp, fm, gm, &bracket, stmin, stmax);
+
+            fx = fxm + stx * gtest;
+            fy = fym + sty * gtest;
+            gx = gxm + gtest;
+            gy = gym + gtest;
+        } else {
+            step(&stx, &fx, &gx, &sty, &fy, &gy, stp, fp, dp, &bracket, stmin, stmax);
+        } // end of if
+
+        // bisect if the interval doesn't shrink enough
+        if (bracket) {
+            if (fabs(sty - stx) >= 0.66 * width1) {
+                *stp = stx + 0.5 * (sty - stx);
+            } // end of if
+
+            width1 = width;
+            width = fabs(sty - stx);
+            stmin = fmin(stx, sty);
+            stmax = fmax(stx, sty);
+        } else {
+            stmin = *stp + 1.1 * (*stp - stx);
+            stmax = *stp + 4 * (*stp - stx);
+        } // end of if
+
+        *stp = fmin(fmax(*stp, 0), stpmax);
+
+        if (!isfinite(*stp) ||
+            (bracket && (*stp <= stmin || *stp >= stmax || stmax - stmin <= STEP_TOLERANCE * stmax))) {
+            *stp = stx;
+        } // end of if
+    } // end of for loop
+
+    // the last trial point is in xNew, if it's not the best one use the best step
+    if (fp <= fx) {
+        *stp = last;
+    } else {
+        *stp = stx;
+        fp = stx > 0 ? evaluate(function, x, work->d, stx, lower, upper, work, evaluations) : f;
+    } // end of if
+
+    return fp;
+} // end of lineSearch
+
+
+unsigned long int lbfgsWorkspaceSize(unsigned int dimension, unsigned int memory) {
+    /*
+     * This function returns number of doubles which lbfgsCompiled function needs as workspace
+     */
+
+    return 2UL * memory * dimension + 2UL * memory + 4UL * dimension;
+} // end of lbfgsWorkspaceSize
+
+
+double lbfgs(const char *expression, unsigned int dimension, double *x, const double *lower, const double *upper,
+             unsigned int memory, double ete, double ere, double tol, unsigned int maxiter, int verbose, int *state) {
+    /*
+     * Limited memory BFGS method finds a local minimum of f(x1, x2, ..., xn). it keeps the last "memory" pairs of
+     * steps and changes of gradient and uses them to estimate product of inverse hessian and gradient (two loop
+     * recursion), so it converges superlinearly with O(memory * n) storage. gradients are exact, they are calculated
+     * by automatic differentiation of the expression, and more-thuente line search finds a step which satisfies
+     * strong wolfe conditions. with bounds, variables which are on a bound and gradient pushes them out are fixed
+     * and the step is limited to the box, like L-BFGS-B.
+     *
+     * ARGUMENTS:
+     * expressions  the function expression with arguments x1, x2, ..., xn like "(1-x1)^2+100*(x2-x1^2)^2",
+     *              "x" can be used for a one argument function
+     * dimension    number of arguments of the function
+     * x            array of size dimension, starting point and it receives the minimum
+     * lower        array of size dimension or NULL, lower bounds of arguments, -INFINITY for no bound
+     * upper        array of size dimension or NULL, upper bounds of arguments, INFINITY for no bound
+     * memory       number of correction pairs to keep, 3 to 20 is usual
+     * ete          estimated true error, compared with the largest change of arguments
+     * ere          estimated relative error
+     * tol          tolerance error, compared with the largest projected gradient
+     * maxiter      maximum iteration threshold
+     * verbose      show process {0: no, 1: yes}
+     * state        is answer found or not, will set value of state to 0 if no answers been found
+     *
+     * RETURN:      value of function at the minimum
+     *
+     */
+
+    // check dimension and memory
+    if (dimension == 0 || memory == 0) {
+        printf("\nError: dimension and memory arguments must be more than zero!\n");
+        Exit(EXIT_FAILURE);
+    } // end of if
+
+    // check error thresholds
+    if (ere < 0 || ete < 0 || tol < 0) {
+        printf("\nError: ete or ere or tol argument is not valid.\n");
+        Exit(EXIT_FAILURE);
+    } // end of if
+
+    // check maxiter to be more than zero
+    if (maxiter <= 0) {
+        printf("\nError: argument maxiter must be more than zero!\n");
+        Exit(EXIT_FAILURE);
+    } // end of maxiter check
+
+    // check verbose
+    if (verbose != 0 && verbose != 1) {
+        printf("\nError: verbose argument is not valid.\n");
+        Exit(EXIT_FAILURE);
+    } // end of if
+
+    // check bounds
+    for (unsigned int i = 0; i < dimension; ++i) {
+        if (lower != NULL && upper != NULL && lower[i] > upper[i]) {
+            printf("\nError: lower bound of x%u is more than it's upper bound!\n", i + 1);
+            Exit(EXIT_FAILURE);
+        } // end of if
+    } // end of for loop
+
+    // initializing variables
+    CompiledFunction function;
+    double *workspace = (double *) malloc(lbfgsWorkspaceSize(dimension, memory) * sizeof(double));
+
+    if (workspace == NULL) {
+        printf("Unable to allocate memory!\n");
+        Exit(EXIT_FAILURE);
+    } // end of if
+
+    compileFunction_n_arg(&function, expression, dimension);
+
+    double f = lbfgsCompiled(&function, x, lower, upper, memory, ete, ere, tol, maxiter, verbose, state, workspace,
+                             NULL);
+
+    freeCompiledFunction(&function);
+    free(workspace);
+    return f;
+} // end of lbfgs function
+
+
+double lbfgsCompiled(const CompiledFunction *function, double *x, const double *lower, const double *upper,
+                     unsigned int memory, double ete, double ere, double tol, unsigned int maxiter, int verbose,
+                     int *state, double *workspace, unsigned long int *evaluations) {
+    /*
+     * Limited memory BFGS method on a compiled function, arguments are the same as lbfgs function but they are not
+     * checked again. workspace must have lbfgsWorkspaceSize(dimension, memory) doubles, nothing is allocated.
+     * if evaluations is not NULL, it receives number of function and gradient evaluations.
+     */
+
+    // initializing variables
+    const unsigned int n = function->dimension;
+    Workspace work = {workspace, workspace + memory * n, workspace + 2 * memory * n,
+                      workspace + 2 * memory * n + memory, workspace + 2 * memory * (n + 1),
+                      workspace + 2 * memory * (n + 1) + n, workspace + 2 * memory * (n + 1) + 2 * n,
+                      workspace + 2 * memory * (n + 1) + 3 * n};
+    unsigned long int count = 0;
+    unsigned int iter = 1, pairs = 0, newest = 0;
+    double f, fNew, stp, stpmax, ete_err, ere_err, pg_err, size, sy, yy;
+    int found = 0, success, moved;
+
+    // start inside the box
+    for (unsigned int i = 0; i < n; ++i) {
+        if (lower != NULL && x[i] < lower[i]) {
+            x[i] = lower[i];
+        } // end of if
+        if (upper != NULL && x[i] > upper[i]) {
+            x[i] = upper[i];
+        } // end of if
+    } // end of for loop
+
+    count++;
+    f = compiledGradient_n_arg(function, x, work.g);
+
+    while (iter <= maxiter) {
+        // variables on a bound which gradient pushes out are fixed, and the rest of gradient is projected gradient
+        pg_err = 0;
+        for (unsigned int i = 0; i < n; ++i) {
+            int fixed = (lower != NULL && x[i] <= lower[i] && work.g[i] > 0) ||
+                        (upper != NULL && x[i] >= upper[i] && work.g[i] < 0);
+            work.d[i] = fixed ? 0 : -work.g[i];
+            pg_err = fmax(pg_err, fabs(work.d[i]));
+        } // end of for loop
+
+        // Termination Criterion
+        // if projected gradient is less than tolerance error
+        if (pg_err <= tol) {
+            if (verbose) {
+                printf("\n\nIn this iteration, the largest projected gradient is less than tolerance error "
+                       "[%.5e <= %.5e],\nso x is the point on domain that minimum of the function happens.\n\n",
+                       pg_err, tol);
+            } // end if(verbose)
+
+            found = 1;
+            break;
+        } // end of tolerance check
+
+        // two loop recursion, d = -H * projected gradient
+        for (unsigned int k = 0; k < pairs; ++k) {
+            unsigned int j = (newest + memory - k) % memory;
+            work.alpha[j] = work.rho[j] * dot(work.s + j * n, work.d, n);
+            for (unsigned int i = 0; i < n; ++i) {
+                work.d[i] -= work.alpha[j] * work.y[j * n + i];
+            }
+        } // end of for loop
+
+        if (pairs > 0) {
+            // scale of initial hessian
+            double scale = dot(work.s + newest * n, work.y + newest * n, n) /
+                           dot(work.y + newest * n, work.y + newest * n, n);
+            for (unsigned int i = 0; i < n; ++i) {
+                work.d[i] *= scale;
+            }
+        } // end of if
+
+        for (unsigned int k = pairs; k > 0; --k) {
+            unsigned int j = (newest + memory - k + 1) % memory;
+            double beta = work.rho[j] * dot(work.y + j * n, work.d, n);
+            for (unsigned int i = 0; i < n; ++i) {
+                work.d[i] += work.s[j * n + i] * (work.alpha[j] - beta);
+            }
+        } // end of for loop
+
+        // keep fixed variables and variables which direction pushes out of the box, and limit the step to the box
+        stpmax = MAXIMUM_STEP;
+        for (unsigned int i = 0; i < n; ++i) {
+            int fixed = (lower != NULL && x[i] <= lower[i] && (work.g[i] > 0 || work.d[i] < 0)) ||
+                        (upper != NULL && x[i] >= upper[i] && (work.g[i] < 0 || work.d[i] > 0));
+
+            if (fixed) {
+                work.d[i] = 0;
+            } else if (work.d[i] < 0 && lower != NULL && isfinite(lower[i])) {
+                stpmax = fmin(stpmax, (lower[i] - x[i]) / work.d[i]);
+            } else if (work.d[i] > 0 && upper != NULL && isfinite(upper[i])) {
+                stpmax = fmin(stpmax, (upper[i] - x[i]) / work.d[i]);
+            } // end of if
+        } // end of for loop
+
+        // if it's not a descent direction, forget the pairs and use steepest descent
+        if (dot(work.g, work.d, n) >= 0 && pairs > 0) {
+            if (verbose) {
+                printf("\nIteration number [#%d]: direction is not a descent direction, pairs are removed.", iter);
+            } // end if(verbose)
+
+            pairs = 0;
+            continue;
+        } // end of if
+
+        // first step is unit step for quasi-newton direction, for steepest descent it's length is one
+        size = sqrt(dot(work.d, work.d, n));
+        stp = fmin(pairs > 0 ? 1 : 1 / size, stpmax);
+
+        fNew = lineSearch(function, x, f, &stp, stpmax, lower, upper, &work, &count, &success);
+
+        // a step which leaves x or f unchanged (like a step into a bound which x is already on) is stagnation
+        moved = 0;
+        for (unsigned int i = 0; i < n; ++i) {
+            if (work.xNew[i] != x[i]) {
+                moved = 1;
+                break;
+            } // end of if
+        } // end of for loop
+
+        // line search can't decrease the function
+        if (stp == 0 || !moved || !(fNew < f)) {
+            if (pairs > 0) {
+                if (verbose) {
+                    printf("\nIteration number [#%d]: line search failed, pairs are removed.", iter);
+                } // end if(verbose)
+
+                pairs = 0;
+                continue;
+            } // end of if
+
+            if (verbose) {
+                printf("\n\nIn this iteration, line search can't decrease the function any more.\n");
+            } // end if(verbose)
+
+            break;
+        } // end of if
+
+        // new correction pair, it's saved only if it keeps the hessian positive definite
+        unsigned int slot = pairs > 0 ? (newest + 1) % memory : newest;
+        ete_err = 0;
+        size = 0;
+        for (unsigned int i = 0; i < n; ++i) {
+            work.s[slot * n + i] = work.xNew[i] - x[i];
+            work.y[slot * n + i] = work.gNew[i] - work.g[i];
+            ete_err = fmax(ete_err, fabs(work.s[slot * n + i]));
+            size = fmax(size, fabs(work.xNew[i]));
+            x[i] = work.xNew[i];
+            work.g[i] = work.gNew[i];
+        } // end of for loop
+
+        sy = dot(work.s + slot * n, work.y + slot * n, n);
+        yy = dot(work.y + slot * n, work.y + slot * n, n);
+        if (sy > DBL_EPSILON * yy) {
+            work.rho[slot] = 1 / sy;
+            newest = slot;
+            if (pairs < memory) {
+                pairs++;
+            } // end of if
+        } else if (pairs == memory) {
+            // the oldest pair has been overwritten
+            pairs--;
+        } // end of if
+
+        ere_err = ete_err / (size > 0 ? size : 1);
+        f = fNew;
+
+        if (verbose) {
+            printf("\nIteration number [#%d]: f(x) = %.10e, step = %.5e, largest change of x = %.5e .",
+                   iter, f, stp, ete_err);
+        } // end if(verbose)
+
+        // if calculated error is less than estimated true error threshold
+        if (ete != 0 && ete_err < ete) {
+            if (verbose) {
+                printf("\n\nIn this iteration, largest change of x < estimated true error [%.5e < %.5e],\n"
+                       "so x is the point on domain that minimum of the function happens.\n\n", ete_err, ete);
+            } // end if(verbose)
+
+            found = 1;
+            break;
+        } // end of estimated true error check
+
+        // if calculated error is less than estimated relative error threshold
+        if (ere != 0 && ere_err < ere) {
+            if (verbose) {
+                printf("\n\nIn this iteration, relative change of x < estimated relative error [%.5e < %.5e],\n"
+                       "so x is the point on domain that minimum of the function happens.\n\n", ere_err, ere);
+            } // end if(verbose)
+
+            found = 1;
+            break;
+        } // end of estimated relative error check
+
+        iter++;
+    } // end of while loop
+
+    // answer didn't found
+    if (!found) {
+        if (verbose) {
+            if (iter > maxiter) {
+                printf("\n\nWith maximum iteration of %d\n", maxiter);
+            } else {
+                printf("\n\nThe solution does not converge.\n");
+            } // end of if ... else
+
+            printf("the last calculated minimum is %lf .\n", f);
+        } // end if(verbose)
+
+        // set state to 0 (false)
+        *state = 0;
+    } // end of if
+
+    if (evaluations != NULL) {
+        *evaluations = count;
+    } // end of if
+
+    return f;
+} // end of lbfgsCompiled function
@@ -0,0 +1,49 @@
+#ifndef C_MATH_LBFGSALGORITHM_H
+#define C_MATH_LBFGSALGORITHM_H
+
+#include "../Util/functions.h"
+
+double lbfgs(const char *expression, unsigned int dimension, double *x, const double *lower, const double *upper,
+             unsigned int memory, double ete, double ere, double tol, unsigned int maxiter, int verbose, int *state);
+/*
+ * Limited memory BFGS method finds a local minimum of f(x1, x2, ..., xn). it keeps the last "memory" pairs of
+ * steps and changes of gradient and uses them to estimate product of inverse hessian and gradient (two loop
+ * recursion), so it converges superlinearly with O(memory * n) storage. gradients are exact, they are calculated
+ * by automatic differentiation of the expression, and more-thuente line search finds a step which satisfies
+ * strong wolfe conditions. with bounds, variables which are on a bound and gradient pushes them out are fixed
+ * and the step is limited to the box, like L-BFGS-B.
+ *
+ * ARGUMENTS:
+ * expressions  the function expression with arguments x1, x2, ..., xn like "(1-x1)^2+100*(x2-x1^2)^2",
+ *              "x" can be used for a one argument function
+ * dimension    number of arguments of the function
+ * x            array of size dimension, starting point and it receives the minimum
+ * lower        array of size dimension or NULL, lower bounds of arguments, -INFINITY for no bound
+ * upper        array of size dimension or NULL, upper bounds of arguments, INFINITY for no bound
+ * memory       number of correction pairs to keep, 3 to 20 is usual
+ * ete          estimated true error, compared with the largest change of arguments
+ * ere          estimated relative error
+ * tol          tolerance error, compared with the largest projected gradient
+ * maxiter      maximum iteration threshold
+ * verbose      show process {0: no, 1: yes}
+ * state        is answer found or not, will set value of state to 0 if no answers been found
+ *
+ * RETURN:      value of function at the minimum
+ *
+ */
+
+double lbfgsCompiled(const CompiledFunction *function, double *x, const double *lower, const double *upper,
+                     unsigned int memory, double ete, double ere, double tol, unsigned int maxiter, int verbose,
+                     int *state, double *workspace, unsigned long int *evaluations);
+/*
+ * Limited memory BFGS method on a compiled function, arguments are the same as lbfgs function but they are not
+ * checked again. workspace must have lbfgsWorkspaceSize(dimension, memory) doubles, nothing is allocated.
+ * if evaluations is not NULL, it receives number of function and gradient evaluations.
+ */
+
+unsigned long int lbfgsWorkspaceSize(unsigned int dimension, unsigned int memory);
+/*
+ * Returns number of doubles which lbfgsCompiled function needs as workspace
+ */
+
+#endif //C_MATH_LBFGSALGORITHM_H
@@ -0,0 +1,319 @@
+#include "nelderMeadAlgorithm.h"
+#include "../Util/functions.h"
+#include "../Util/util.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+static void evaluateVertices(const CompiledFunction *function, const double *simplex, double *values,
+                             unsigned int n, unsigned int skip, double *points, double *results) {
+    /*
+     * This function evaluates all vertices of simplex except vertex "skip" in one batch,
+     * vertex i is simplex[i * n ... i * n + n - 1]
+     */
+
+    unsigned int count = 0;
+
+    // structure of arrays, coordinate j of point k is points[j * (n + 1) + k]
+    for (unsigned int i = 0; i <= n; ++i) {
+        if (i == skip) {
+            continue;
+        } // end of if
+
+        for (unsigned int j = 0; j < n; ++j) {
+            points[j * (n + 1) + count] = simplex[i * n + j];
+        } // end of for loop
+        count++;
+    } // end of for loop
+
+    compiledFunctionBatch_n_arg(function, points, count, n + 1, results);
+
+    count = 0;
+    for (unsigned int i = 0; i <= n; ++i) {
+        if (i != skip) {
+            values[i] = results[count++];
+        } // end of if
+    } // end of for loop
+} // end of evaluateVertices
+
+
+double nelderMead(const char *expression, unsigned int dimension, double *x, double size, int adaptive,
+                  unsigned int restarts, double ete, double ere, double tol, unsigned int maxiter, int verbose,
+                  int *state) {
+    /*
+     * Nelder-Mead method finds a local minimum of f(x1, x2, ..., xn) without derivatives, so it works for noisy
+     * and non-differentiable functions like abs, floor and ceil. it keeps a simplex of n + 1 points and replaces
+     * the worst point by it's reflection through centroid of the other points, or by an expansion or a contraction
+     * of it, and if none of them is better the simplex shrinks toward the best point.
+     * coefficients of reflection, expansion, contraction and shrink are 1, 2, 0.5, 0.5 or with adaptive
+     * coefficients 1, 1 + 2/n, 0.75 - 1/2n, 1 - 1/n which keep the method efficient in high dimensions
+     * (for one argument the standard coefficients are used). the simplex collapses on a minimum, so after
+     * convergence the method restarts from a new simplex around the best point, until a restart doesn't improve it.
+     *
+     * ARGUMENTS:
+     * expressions  the function expression with arguments x1, x2, ..., xn like "abs(x1-1)+(x2+2)^2",
+     *              "x" can be used for a one argument function
+     * dimension    number of arguments of the function
+     * x            array of size dimension, starting point and it receives the minimum
+     * size         length of edges of the initial simplex
+     * adaptive     use adaptive coefficients {0: no, 1: yes}
+     * restarts     maximum number of restarts
+     * ete          estimated true error, compared with the largest distance of points from the best point
+     * ere          estimated relative error
+     * tol          tolerance error, compared with difference of function at the worst and the best point
+     * maxiter      maximum iteration threshold, for all restarts
+     * verbose      show process {0: no, 1: yes}
+     * state        is answer found or not, will set value of state to 0 if no answers been found
+     *
+     * RETURN:      value of function at the minimum
+     *
+     */
+
+    // check dimension and size
+    if (dimension == 0 || size <= 0) {
+        printf("\nError: dimension and size arguments must be more than zero!\n");
+        Exit(EXIT_FAILURE);
+    } // end of if
+
+    // check error thresholds
+    if (ere < 0 || ete < 0 || tol < 0) {
+        printf("\nError: ete or ere or tol argument is not valid.\n");
+        Exit(EXIT_FAILURE);
+    } // end of if
+
+    // check maxiter to be more than zero
+    if (maxiter <= 0) {
+        printf("\nError: argument maxiter must be more than zero!\n");
+        Exit(EXIT_FAILURE);
+    } // end of maxiter check
+
+    // check verbose and adaptive
+    if ((verbose != 0 && verbose != 1) || (adaptive != 0 && adaptive != 1)) {
+        printf("\nError: either adaptive or verbose argument is not valid.\n");
+        Exit(EXIT_FAILURE);
+    } // end of if
+
+    // initializing variables
+    const unsigned int n = dimension;
+    const double reflection = 1;
+    const double expansion = adaptive && n > 1 ? 1 + 2.0 / n : 2;
+    const double contraction = adaptive && n > 1 ? 0.75 - 1.0 / (2 * n) : 0.5;
+    const double shrink = adaptive && n > 1 ? 1 - 1.0 / n : 0.5;
+    // all storage is allocated once, simplex, values, centroid, two trial points and batch of points
+    double *memory = (double *) malloc(((n + 1) * n + (n + 1) + 3 * n + (n + 1) * n + (n + 1)) * sizeof(double));
+
+    if (memory == NULL) {
+        printf("Unable to allocate memory!\n");
+        Exit(EXIT_FAILURE);
+    } // end of if
+
+    double *simplex = memory, *values = simplex + (n + 1) * n, *centroid = values + n + 1;
+    double *xr = centroid + n, *xt = xr + n, *points = xt + n, *results = points + (n + 1) * n;
+    double fr, ft, best = 0, ete_err, ere_err, spread, scale;
+    unsigned int iter = 1, restart = 0, b, w, s;
+    int found = 0, converged, operation;
+    const char *operations[] = {"reflection", "expansion", "contraction", "shrink"};
+
+    CompiledFunction function;
+    compileFunction_n_arg(&function, expression, n);
+
+    while (1) {
+        // initial simplex, the starting point and one point along every axis
+        for (unsigned int i = 0; i <= n; ++i) {
+            for (unsigned int j = 0; j < n; ++j) {
+                simplex[i * n + j] = x[j] + (i == j + 1 ? size : 0);
+            } // end of for loop
+        } // end of for loop
+
+        evaluateVertices(&function, simplex, values, n, n + 1, points, results);
+        converged = 0;
+
+        while (iter <= maxiter) {
+            // find the best, the worst and the second worst points
+            b = 0;
+            w = 0;
+            for (unsigned int i = 1; i <= n; ++i) {
+                if (values[i] < values[b]) {
+                    b = i;
+                } // end of if
+                if (values[i] >= values[w]) {
+                    w = i;
+                } // end of if
+            } // end of for loop
+
+            s = b;
+            for (unsigned int i = 0; i <= n; ++i) {
+                if (i != w && values[i] >= values[s]) {
+                    s = i;
+                } // end of if
+            } // end of for loop
+
+            // calculate errors
+            ete_err = 0;
+            scale = 0;
+            for (unsigned int i = 0; i <= n; ++i) {
+                for (unsigned int j = 0; j < n; ++j) {
+                    ete_err = fmax(ete_err, fabs(simplex[i * n + j] - simplex[b * n + j]));
+                } // end of for loop
+            } // end of for loop
+            for (unsigned int j = 0; j < n; ++j) {
+                scale = fmax(scale, fabs(simplex[b * n + j]));
+            } // end of for loop
+            ere_err = ete_err / (scale > 0 ? scale : 1);
+            spread = values[w] - values[b];
+
+            // Termination Criterion
+            // if calculated error is less than estimated true error threshold
+            if (ete != 0 && ete_err < ete) {
+                if (verbose) {
+                    printf("\nIn this iteration the size of simplex is less than estimated true error.\n"
+                           "(size of simplex) %.5e < %.5e (threshold).\n", ete_err, ete);
+                } // end if(verbose)
+
+                converged = 1;
+                break;
+            } // end of estimated true error check
+
+            // if calculated error is less than estimated relative error threshold
+            if (ere != 0 && ere_err < ere) {
+                if (verbose) {
+                    printf("\nIn this iteration the relative size of simplex is less than estimated relative error.\n"
+                           "(relative size of simplex) %.5e < %.5e (threshold).\n", ere_err, ere);
+                } // end if(verbose)
+
+                converged = 1;
+                break;
+            } // end of estimated relative error check
+
+            // if function has the same value on simplex
+            if (spread <= tol) {
+                if (verbose) {
+                    printf("\nIn this iteration the difference of function on simplex is less than tolerance error.\n"
+                           "(difference) %.5e <= %.5e (threshold).\n", spread, tol);
+                } // end if(verbose)
+
+                converged = 1;
+                break;
+            } // end of tolerance check
+
+            // centroid of all points except the worst one
+            for (unsigned int j = 0; j < n; ++j) {
+                centroid[j] = 0;
+                for (unsigned int i = 0; i <= n; ++i) {
+                    if (i != w) {
+                        centroid[j] += simplex[i * n + j];
+                    } // end of if
+                } // end of for loop
+                centroid[j] /= n;
+            } // end of for loop
+
+            // reflection
+            for (unsigned int j = 0; j < n; ++j) {
+                xr[j] = centroid[j] + reflection * (centroid[j] - simplex[w * n + j]);
+            } // end of for loop
+            fr = compiledFunction_n_arg(&function, xr);
+
+            if (fr < values[b]) {
+                // expansion
+                for (unsigned int j = 0; j < n; ++j) {
+                    xt[j] = centroid[j] + expansion * (xr[j] - centroid[j]);
+                } // end of for loop
+                ft = compiledFunction_n_arg(&function, xt);
+
+                operation = ft < fr ? 1 : 0;
+            } else if (fr < values[s]) {
+                operation = 0;
+            } else {
+                // outside contraction if reflection is better than the worst point, otherwise inside contraction
+                for (unsigned int j = 0; j < n; ++j) {
+                    xt[j] = fr < values[w] ? centroid[j] + contraction * (xr[j] - centroid[j])
+                                           : centroid[j] + contraction * (simplex[w * n + j] - centroid[j]);
+                } // end of for loop
+                ft = compiledFunction_n_arg(&function, xt);
+
+                operation = ft < fmin(fr, values[w]) ? 2 : 3;
+            } // end of if
+
+            // replace the worst point or shrink the simplex toward the best point
+            if (operation == 3) {
+                for (unsigned int i = 0; i <= n; ++i) {
+                    for (unsigned int j = 0; j < n && i != b; ++j) {
+                        simplex[i * n + j] = simplex[b * n + j] + shrink * (simplex[i * n + j] - simplex[b * n + j]);
+                    } // end of for loop
+                } // end of for loop
+
+                evaluateVertices(&function, simplex, values, n, b, points, results);
+            } else {
+                const double *replacement = operation == 0 ? xr : xt;
+                for (unsigned int j = 0; j < n; ++j) {
+                    simplex[w * n + j] = replacement[j];
+                } // end of for loop
+                values[w] = operation == 0 ? fr : ft;
+            } // end of if
+
+            if (verbose) {
+                ft = values[0];
+                for (unsigned int i = 1; i <= n; ++i) {
+                    ft = fmin(ft, values[i]);
+                } // end of for loop
+
+                printf("\nIn this iteration [#%d], %s step, f(best point) = %.5e\n"
+                       "and size of simplex = %.5e and difference of function on simplex = %.5e .\n",
+                       iter, operations[operation], ft, ete_err, spread);
+            } // end if(verbose)
+
+            iter++;
+        } // end of while loop
+
+        // best point of simplex
+        b = 0;
+        for (unsigned int i = 1; i <= n; ++i) {
+            if (values[i] < values[b]) {
+                b = i;
+            } // end of if
+        } // end of for loop
+
+        // a restart must improve the minimum, otherwise the last answer is kept
+        if (restart > 0 && !(values[b] < best)) {
+            found = found || converged;
+            break;
+        } // end of if
+
+        for (unsigned int j = 0; j < n; ++j) {
+            x[j] = simplex[b * n + j];
+        } // end of for loop
+        best = values[b];
+        found = converged;
+
+        if (!converged || restart == restarts) {
+            break;
+        } // end of if
+
+        restart++;
+        if (verbose) {
+            printf("\nRestart [#%d] from the best point with f(x) = %.5e .\n", restart, best);
+        } // end if(verbose)
+    } // end of while loop
+
+    freeCompiledFunction(&function);
+    free(memory);
+
+    // answer didn't found
+    if (!found) {
+        if (verbose) {
+            if (ete == 0 && ere == 0 && tol == 0) {
+                printf("\nWith maximum iteration of %d\n", maxiter);
+            } else {
+                printf("\nThe solution does not converge or iterations are not sufficient.\n");
+            } // end of if ... else
+
+            printf("the last calculated minimum is %lf .\n", best);
+        } // end if(verbose)
+
+        // set state to 0 (false)
+        *state = 0;
+    } // end of if
+
+    return best;
+} // end of nelderMead function
@@ -0,0 +1,36 @@
+#ifndef C_MATH_NELDERMEADALGORITHM_H
+#define C_MATH_NELDERMEADALGORITHM_H
+
+double nelderMead(const char *expression, unsigned int dimension, double *x, double size, int adaptive,
+                  unsigned int restarts, double ete, double ere, double tol, unsigned int maxiter, int verbose,
+                  int *state);
+/*
+ * Nelder-Mead method finds a local minimum of f(x1, x2, ..., xn) without derivatives, so it works for noisy
+ * and non-differentiable functions like abs, floor and ceil. it keeps a simplex of n + 1 points and replaces
+ * the worst point by it's reflection through centroid of the other points, or by an expansion or a contraction
+ * of it, and if none of them is better the simplex shrinks toward the best point.
+ * coefficients of reflection, expansion, contraction and shrink are 1, 2, 0.5, 0.5 or with adaptive
+ * coefficients 1, 1 + 2/n, 0.75 - 1/2n, 1 - 1/n which keep the method efficient in high dimensions
+ * (for one argument the standard coefficients are used). the simplex collapses on a minimum, so after
+ * convergence the method restarts from a new simplex around the best point, until a restart doesn't improve it.
+ *
+ * ARGUMENTS:
+ * expressions  the function expression with arguments x1, x2, ..., xn like "abs(x1-1)+(x2+2)^2",
+ *              "x" can be used for a one argument function
+ * dimension    number of arguments of the function
+ * x            array of size dimension, starting point and it receives the minimum
+ * size         length of edges of the initial simplex
+ * adaptive     use adaptive coefficients {0: no, 1: yes}
+ * restarts     maximum number of restarts
+ * ete          estimated true error, compared with the largest distance of points from the best point
+ * ere          estimated relative error
+ * tol          tolerance error, compared with difference of function at the worst and the best point
+ * maxiter      maximum iteration threshold, for all restarts
+ * verbose      show process {0: no, 1: yes}
+ * state        is answer found or not, will set value of state to 0 if no answers been found
+ *
+ * RETURN:      value of function at the minimum
+ *
+ */
+
+#endif //C_MATH_NELDERMEADALGORITHM_H
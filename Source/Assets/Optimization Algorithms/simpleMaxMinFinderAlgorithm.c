@@ -1,31 +1,75 @@
 #include "simpleMaxMinFinderAlgorithm.h"
+#include "brentMinimizerAlgorithm.h"
 #include "../Util/functions.h"
 #include "../Util/util.h"
+#include "../Util/_configurations.h"
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <math.h>
 
-double *simpleMaxMinFinder(const char *expression, double a, double b, unsigned int n) {
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+typedef struct {
+    // grid index of the best local extrema, sorted from the best one
+    unsigned int *index;
+    // sign * f of them, sign is -1 for maximum so smaller is always better
+    double *value;
+    unsigned int size;
+} Candidates;
+
+static void insertCandidate(Candidates *candidates, unsigned int cells, unsigned int index, double value) {
     /*
-     * this function will find global maximum and minimum of a function in interval [a, b]
-     * through sampling y = f(x) and comparing it with previous values
+     * This function inserts a grid index in the sorted list of the best local extrema,
+     * if the list is full the worst one is dropped
+     */
+
+    if (candidates->size == cells && value >= candidates->value[cells - 1]) {
+        return;
+    } // end of if
+
+    unsigned int i = candidates->size < cells ? candidates->size++ : cells - 1;
+
+    // shift worse candidates
+    while (i > 0 && candidates->value[i - 1] > value) {
+        candidates->index[i] = candidates->index[i - 1];
+        candidates->value[i] = candidates->value[i - 1];
+        i--;
+    } // end of while loop
+
+    candidates->index[i] = index;
+    candidates->value[i] = value;
+} // end of insertCandidate
+
+
+void maxMinFinder(const char *expression, double a, double b, unsigned int n, unsigned int cells, double ete,
+                  double ere, unsigned int maxiter, double *results, double *values) {
+    /*
+     * this function will find global maximum and minimum of a function in interval [a, b].
+     * first it samples y = f(x) on a grid of n + 1 points, the grid is evaluated in parallel blocks of BLOCK_SIZE
+     * points. every grid point which is not worse than it's neighbours is a local extremum of the grid,
+     * then the best "cells" local maxima and minima are polished with brent's method over their neighbouring cells,
+     * so the extrema are found with full precision and a coarse grid is enough to separate them.
+     * it is reentrant, results are written to the given arrays.
      *
      * ARGUMENTS:
      * expressions   the function expression, it must be a string array like "x^2+1"
      * a             starting point of interval [a, b]
      * b             ending point of interval [a, b]
      * n             number of sub-intervals to use
-     *
-     * RETURN:       a pointer to a double array of size 2
-     *               this array contains x where maximum
-     *               and minimum of function occurs
-     *               result[0] = maximum
-     *               result[1] = minimum
+     * cells         number of the best local maxima and minima of grid to polish {0: only use the grid}
+     * ete           estimated true error of brent's method
+     * ere           estimated relative error of brent's method
+     * maxiter       maximum iteration threshold of brent's method
+     * results       array of size 2, results[0] = x where maximum occurs, results[1] = x where minimum occurs
+     * values        array of size 2 or NULL, values[0] = maximum of function, values[1] = minimum of function
      *
      */
 
     // fix interval reverse
-    if (a > b){
+    if (a > b) {
         double temp = a;
         a = b;
         b = temp;
@@ -38,30 +82,189 @@ double *simpleMaxMinFinder(const char *expression, double a, double b, unsigned
         Exit(EXIT_FAILURE);
     } // end of n check
 
+    // check error thresholds
+    if (ere < 0 || ete < 0) {
+        printf("\nError: ete or ere arguments are not valid.\n");
+        Exit(EXIT_FAILURE);
+    } // end of if
+
+    // check maxiter to be more than zero
+    if (cells > 0 && maxiter <= 0) {
+        printf("\nError: argument maxiter must be more than zero!\n");
+        Exit(EXIT_FAILURE);
+    } // end of maxiter check
+
     // initializing variables
+    const double coefficient = (b - a) / n;
+    // even an unpolished grid needs it's best point
+    const unsigned int size = cells > 0 ? cells : 1;
+    long int blocks = (long int) (((unsigned long int) n + BLOCK_SIZE) / BLOCK_SIZE);
+    int threads = 1;
+#ifdef _OPENMP
+    threads = omp_get_max_threads();
+#endif
+    CompiledFunction *functions = (CompiledFunction *) malloc(threads * sizeof(CompiledFunction));
+    // maximum and minimum candidates of every thread, and merged candidates at the end
+    Candidates *candidates = (Candidates *) malloc(2 * (threads + 1) * sizeof(Candidates));
+    unsigned int *indexes = (unsigned int *) malloc(2 * (threads + 1) * size * sizeof(unsigned int));
+    double *candidateValues = (double *) malloc(2 * (threads + 1) * size * sizeof(double));
+
+    if (functions == NULL || candidates == NULL || indexes == NULL || candidateValues == NULL) {
+        printf("Unable to allocate memory!\n");
+        Exit(EXIT_FAILURE);
+    } // end of if
+
+    for (int t = 0; t < 2 * (threads + 1); ++t) {
+        candidates[t].index = indexes + t * size;
+        candidates[t].value = candidateValues + t * size;
+        candidates[t].size = 0;
+    } // end of for loop
+
+    // every thread evaluates it's own copy of the function
+    for (int t = 0; t < threads; ++t) {
+        compileFunction_n_arg(&functions[t], expression, 1);
+    } // end of for loop
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) num_threads(threads)
+#endif
+    for (long int block = 0; block < blocks; ++block) {
+#ifdef _OPENMP
+        int id = omp_get_thread_num();
+#else
+        int id = 0;
+#endif
+        // a block is grid points [first, last) and one neighbour on each side
+        double points[BLOCK_SIZE + 2], y[BLOCK_SIZE + 2];
+        unsigned long int first = (unsigned long int) block * BLOCK_SIZE;
+        unsigned long int last = first + BLOCK_SIZE < (unsigned long int) n + 1 ? first + BLOCK_SIZE : n + 1UL;
+        unsigned long int low = first > 0 ? first - 1 : 0;
+        unsigned long int high = last < (unsigned long int) n + 1 ? last + 1 : last;
+
+        for (unsigned long int i = low; i < high; ++i) {
+            points[i - low] = i == n ? b : a + coefficient * i;
+        } // end of for loop
+
+        compiledFunctionBatch_n_arg(&functions[id], points, high - low, high - low, y);
+
+        for (unsigned long int i = first; i < last; ++i) {
+            unsigned long int k = i - low;
+            double left = i > 0 ? y[k - 1] : y[k], right = i < n ? y[k + 1] : y[k];
+
+            // local maximum of grid
+            if (y[k] >= left && y[k] >= right) {
+                insertCandidate(&candidates[2 * id], size, (unsigned int) i, -y[k]);
+            } // end of if
+
+            // local minimum of grid
+            if (y[k] <= left && y[k] <= right) {
+                insertCandidate(&candidates[2 * id + 1], size, (unsigned int) i, y[k]);
+            } // end of if
+        } // end of for loop
+    } // end of parallel for loop
+
+    // merge candidates of threads, the last two lists are the merged ones
+    Candidates *maximums = &candidates[2 * threads], *minimums = &candidates[2 * threads + 1];
+    for (int t = 0; t < threads; ++t) {
+        for (unsigned int i = 0; i < candidates[2 * t].size; ++i) {
+            insertCandidate(maximums, size, candidates[2 * t].index[i], candidates[2 * t].value[i]);
+        } // end of for loop
+
+        for (unsigned int i = 0; i < candidates[2 * t + 1].size; ++i) {
+            insertCandidate(minimums, size, candidates[2 * t + 1].index[i], candidates[2 * t + 1].value[i]);
+        } // end of for loop
+    } // end of for loop
+
+    // best points of grid, they are replaced only if polishing finds a better point
+    // if the function is not a number on whole grid, the interval bounds are returned
+    double x[2] = {b, a}, fx[2] = {NAN, NAN};
+    if (maximums->size > 0) {
+        x[0] = maximums->index[0] == n ? b : a + coefficient * maximums->index[0];
+        fx[0] = -maximums->value[0];
+    } // end of if
+    if (minimums->size > 0) {
+        x[1] = minimums->index[0] == n ? b : a + coefficient * minimums->index[0];
+        fx[1] = minimums->value[0];
+    } // end of if
+
+    // polish candidates with brent's method over their neighbouring cells
+    long int tasks = (long int) (maximums->size + minimums->size);
+    if (cells == 0) {
+        tasks = 0;
+    } // end of if
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1) num_threads(threads)
+#endif
+    for (long int task = 0; task < tasks; ++task) {
+#ifdef _OPENMP
+        int id = omp_get_thread_num();
+#else
+        int id = 0;
+#endif
+        // 0 for maximum and 1 for minimum
+        int type = task < (long int) maximums->size ? 0 : 1;
+        unsigned int index = type == 0 ? maximums->index[task] : minimums->index[task - maximums->size];
+        double low = index > 0 ? a + coefficient * (index - 1) : a;
+        double high = index + 1 < n ? a + coefficient * (index + 1) : b;
+        double value;
+        int state = 1;
+
+        double point = brentMinimizerCompiled(&functions[id], low, high, ete, ere, maxiter, type == 0 ? 1 : 0, 0,
+                                              &state, &value);
+
+#ifdef _OPENMP
+#pragma omp critical(maxMinFinderBest)
+#endif
+        {
+            if ((type == 0 && value > fx[0]) || (type == 1 && value < fx[1])) {
+                x[type] = point;
+                fx[type] = value;
+            } // end of if
+        } // end of critical section
+    } // end of parallel for loop
+
+    for (int t = 0; t < threads; ++t) {
+        freeCompiledFunction(&functions[t]);
+    } // end of for loop
+    free(functions);
+    free(candidates);
+    free(indexes);
+    free(candidateValues);
+
+    // assign values to arrays
+    results[0] = x[0];
+    results[1] = x[1];
+
+    if (values != NULL) {
+        values[0] = fx[0];
+        values[1] = fx[1];
+    } // end of if
+} // end of maxMinFinder function
+
+
+double *simpleMaxMinFinder(const char *expression, double a, double b, unsigned int n) {
+    /*
+     * this function will find global maximum and minimum of a function in interval [a, b]
+     * through sampling y = f(x) and comparing it with previous values.
+     * it returns a static array, so it's not reentrant, maxMinFinder function is the reentrant version
+     * which can polish the extrema too.
+     *
+     * ARGUMENTS:
+     * expressions   the function expression, it must be a string array like "x^2+1"
+     * a             starting point of interval [a, b]
+     * b             ending point of interval [a, b]
+     * n             number of sub-intervals to use
+     *
+     * RETURN:       a pointer to a double array of size 2
+     *               this array contains x where maximum
+     *               and minimum of function occurs
+     *               result[0] = maximum
+     *               result[1] = minimum
+     *
+     */
+
     static double results[2];
-    double coefficient = (b - a) / n;
-    // arbitrary value for max and min
-    double x, y, max = b, min = a;
-    // arbitrary value for fmax and fmin at start of program
-    double fmax = function_1_arg(expression, b), fmin = fmax;
-
-    for (unsigned int i = 0; i <= n; ++i) {
-        // new x sample at interval
-        x = a + coefficient * i;
-        y = function_1_arg(expression, x);
-
-        // compare y with fmax, fmin and then update
-        if (y > fmax) {
-            fmax = y;
-            max = x;
-        } else if (y < fmin) {
-            fmin = y;
-            min = x;
-        }
-    }
-    // assign values to array
-    results[0] = max;
-    results[1] = min;
+    maxMinFinder(expression, a, b, n, 0, 0, 0, 1, results, NULL);
     return results;
-} // end of simpleMaxMinFinder
\ No newline at end of file
+} // end of simpleMaxMinFinder
@@ -1,6 +1,40 @@
 #ifndef C_MATH_SIMPLEMAXMINFINDERALGORITHM_H
 #define C_MATH_SIMPLEMAXMINFINDERALGORITHM_H
 
+void maxMinFinder(const char *expression, double a, double b, unsigned int n, unsigned int cells, double ete,
+                  double ere, unsigned int maxiter, double *results, double *values);
+/*
+ * this function will find global maximum and minimum of a function in interval [a, b].
+ * first it samples y = f(x) on a grid of n + 1 points, the grid is evaluated in parallel blocks of BLOCK_SIZE
+ * points. every grid point which is not worse than it's neighbours is a local extremum of the grid,
+ * then the best "cells" local maxima and minima are polished with brent's method over their neighbouring cells,
+ * so the extrema are found with full precision and a coarse grid is enough to separate them.
+ * it is reentrant, results are written to the given arrays.
+ *
+ * ARGUMENTS:
+ * expressions   the function expression, it must be a string array like "x^2+1"
+ * a             starting point of interval [a, b]
+ * b             ending point of interval [a, b]
+ * n             number of sub-intervals to use
+ * cells         number of the best local maxima and minima of grid to polish {0: only use the grid}
+ * ete           estimated true error of brent's method
+ * ere           estimated relative error of brent's method
+ * maxiter       maximum iteration threshold of brent's method
+ * results       array of size 2, results[0] = x where maximum occurs, results[1] = x where minimum occurs
+ * values        array of size 2 or NULL, values[0] = maximum of function, values[1] = minimum of function
+ *
+ */
+
 double *simpleMaxMinFinder(const char *expression, double a, double b, unsigned int n);
+/*
+ * this function will find global maximum and minimum of a function in interval [a, b]
+ * through sampling y = f(x) and comparing it with previous values.
+ * it returns a static array, so it's not reentrant, maxMinFinder function is the reentrant version
+ * which can polish the extrema too.
+ *
+ * RETURN:       a pointer to a double array of size 2
+ *               result[0] = x where maximum occurs
+ *               result[1] = x where minimum occurs
+ */
 
 #endif //C_MATH_SIMPLEMAXMINFINDERALGORITHM_H
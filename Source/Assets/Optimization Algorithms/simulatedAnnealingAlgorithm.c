@@ -0,0 +1,273 @@
+#include "simulatedAnnealingAlgorithm.h"
+#include "../Util/functions.h"
+#include "../Util/randomGenerator.h"
+#include "../Util/util.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+// temperature is multiplied by COOLING in every step, a cycle ends when it's less than FROZEN * initial temperature
+#define COOLING 0.98
+#define FROZEN 1e-9
+// every reheating starts from half of the previous reheating temperature
+#define REHEATING 0.5
+
+
+double simulatedAnnealing(const char *expression, unsigned int dimension, const double *lower, const double *upper,
+                          unsigned int chains, double temperature, unsigned int reheats, double ete, double ere,
+                          double tol, unsigned long int budget, uint64_t seed, double *x, int verbose, int *state) {
+    /*
+     * Simulated annealing finds the global minimum of f(x1, x2, ..., xn) inside a box. it runs a population of
+     * independent chains, in every step each chain proposes a random move whose length shrinks with temperature,
+     * and accepts it if it's better or with probability exp(-(f(new) - f(old)) / temperature), so at high
+     * temperature chains can climb out of local minima. temperature is multiplied by 0.98 in every step, and when
+     * chains converge or freeze, the temperature is reheated to half of the last reheating temperature and chains
+     * restart from the best point found, which explores around the best basin again. proposals of a step are
+     * evaluated in parallel batches, and all random numbers come from one generator, so a seed always gives
+     * the same result with any number of threads.
+     *
+     * ARGUMENTS:
+     * expressions  the function expression with arguments x1, x2, ..., xn like "sin(10*x1)*x1^2",
+     *              "x" can be used for a one argument function
+     * dimension    number of arguments of the function
+     * lower        array of size dimension, lower bounds of arguments
+     * upper        array of size dimension, upper bounds of arguments
+     * chains       number of chains
+     * temperature  initial temperature, or 0 to use standard deviation of function on the first chains
+     * reheats      maximum number of reheatings
+     * ete          estimated true error, compared with the largest width of chains along an argument
+     * ere          estimated relative error
+     * tol          tolerance error, compared with difference of function at the worst and the best chain
+     * budget       maximum number of function evaluations
+     * seed         seed of random generator
+     * x            array of size dimension, it receives the minimum
+     * verbose      show process {0: no, 1: yes}
+     * state        is answer found or not, will set value of state to 0 if the budget is used before the last cycle
+     *              of annealing ends
+     *
+     * RETURN:      value of function at the minimum
+     *
+     */
+
+    // check dimension and chains
+    if (dimension == 0 || chains == 0) {
+        printf("\nError: dimension and chains arguments must be more than zero!\n");
+        Exit(EXIT_FAILURE);
+    } // end of if
+
+    // check error thresholds and temperature
+    if (ere < 0 || ete < 0 || tol < 0 || temperature < 0) {
+        printf("\nError: ete or ere or tol or temperature argument is not valid.\n");
+        Exit(EXIT_FAILURE);
+    } // end of if
+
+    // check budget to be enough for first chains
+    if (budget < chains) {
+        printf("\nError: budget must be at least the number of chains!\n");
+        Exit(EXIT_FAILURE);
+    } // end of budget check
+
+    // check verbose
+    if (verbose != 0 && verbose != 1) {
+        printf("\nError: verbose argument is not valid.\n");
+        Exit(EXIT_FAILURE);
+    } // end of if
+
+    // check bounds
+    for (unsigned int j = 0; j < dimension; ++j) {
+        if (!(lower[j] <= upper[j]) || !isfinite(lower[j]) || !isfinite(upper[j])) {
+            printf("\nError: bounds of x%u are not a proper interval!\n", j + 1);
+            Exit(EXIT_FAILURE);
+        } // end of if
+    } // end of for loop
+
+    // initializing variables
+    const unsigned int n = dimension, size = chains;
+    int threads = 1;
+#ifdef _OPENMP
+    threads = omp_get_max_threads();
+#endif
+    // chains and proposals as structure of arrays, their values and the best point
+    double *points = (double *) malloc((2 * ((unsigned long int) n * size + size) + n) * sizeof(double));
+    CompiledFunction *functions = (CompiledFunction *) malloc(threads * sizeof(CompiledFunction));
+
+    if (points == NULL || functions == NULL) {
+        printf("Unable to allocate memory!\n");
+        Exit(EXIT_FAILURE);
+    } // end of if
+
+    double *proposals = points + n * size, *values = proposals + n * size, *proposalValues = values + size;
+    double *best = proposalValues + size;
+    double fbest = NAN, start, t, length, ete_err, ere_err, spread, scale, low, high, mean = 0, variance = 0;
+    unsigned long int evaluations = 0;
+    unsigned int step = 1, reheat = 0;
+    int found = 0, cycleEnd;
+    Xoshiro256State random;
+
+    // every thread evaluates it's own copy of the function
+    for (int t = 0; t < threads; ++t) {
+        compileFunction_n_arg(&functions[t], expression, n);
+    } // end of for loop
+
+    // chains start uniform in the box
+    seedXoshiro256(&random, seed);
+    for (unsigned int i = 0; i < size; ++i) {
+        for (unsigned int j = 0; j < n; ++j) {
+            points[j * size + i] = lower[j] + (upper[j] - lower[j]) * zeroToOneXoshiro256(&random);
+        } // end of for loop
+    } // end of for loop
+
+    compiledFunctionParallel_n_arg(functions, threads, points, size, values);
+    evaluations += size;
+
+    // the best point and standard deviation of function on chains
+    for (unsigned int i = 0; i < size; ++i) {
+        if (values[i] < fbest || isnan(fbest)) {
+            fbest = values[i];
+            for (unsigned int j = 0; j < n; ++j) {
+                best[j] = points[j * size + i];
+            } // end of for loop
+        } // end of if
+
+        mean += values[i] / size;
+    } // end of for loop
+    for (unsigned int i = 0; i < size; ++i) {
+        variance += (values[i] - mean) * (values[i] - mean) / size;
+    } // end of for loop
+
+    start = temperature > 0 ? temperature : sqrt(variance);
+    if (!(start > 0) || !isfinite(start)) {
+        start = 1;
+    } // end of if
+    t = start;
+
+    while (evaluations + size <= budget) {
+        // proposals, move length is relative to the box and shrinks with square root of temperature
+        length = 0.5 * sqrt(t / start);
+        for (unsigned int i = 0; i < size; ++i) {
+            for (unsigned int j = 0; j < n; ++j) {
+                const double current = points[j * size + i];
+                double v = current + length * (upper[j] - lower[j]) * (2 * zeroToOneXoshiro256(&random) - 1);
+
+                // a proposal out of box goes back to a random point between current point and the bound
+                if (v < lower[j]) {
+                    v = lower[j] + (current - lower[j]) * zeroToOneXoshiro256(&random);
+                } else if (v > upper[j]) {
+                    v = upper[j] - (upper[j] - current) * zeroToOneXoshiro256(&random);
+                } // end of if
+
+                proposals[j * size + i] = v;
+            } // end of for loop
+        } // end of for loop
+
+        compiledFunctionParallel_n_arg(functions, threads, proposals, size, proposalValues);
+        evaluations += size;
+
+        // metropolis acceptance
+        for (unsigned int i = 0; i < size; ++i) {
+            const double delta = proposalValues[i] - values[i];
+
+            if (delta <= 0 || (isnan(values[i]) && !isnan(proposalValues[i])) ||
+                zeroToOneXoshiro256(&random) < exp(-delta / t)) {
+                for (unsigned int j = 0; j < n; ++j) {
+                    points[j * size + i] = proposals[j * size + i];
+                } // end of for loop
+                values[i] = proposalValues[i];
+
+                if (values[i] < fbest || isnan(fbest)) {
+                    fbest = values[i];
+                    for (unsigned int j = 0; j < n; ++j) {
+                        best[j] = points[j * size + i];
+                    } // end of for loop
+                } // end of if
+            } // end of if
+        } // end of for loop
+
+        // calculate errors
+        ete_err = 0;
+        scale = 0;
+        spread = 0;
+        for (unsigned int j = 0; j < n; ++j) {
+            low = high = points[j * size];
+            for (unsigned int i = 1; i < size; ++i) {
+                low = fmin(low, points[j * size + i]);
+                high = fmax(high, points[j * size + i]);
+            } // end of for loop
+            ete_err = fmax(ete_err, high - low);
+            scale = fmax(scale, fabs(best[j]));
+        } // end of for loop
+        for (unsigned int i = 0; i < size; ++i) {
+            spread = fmax(spread, values[i] - fbest);
+        } // end of for loop
+        ere_err = ete_err / (scale > 0 ? scale : 1);
+
+        if (verbose) {
+            printf("\nIn this step [#%d], temperature = %.5e, f(best point) = %.10e\n"
+                   "and width of chains = %.5e and difference of function on chains = %.5e .\n",
+                   step, t, fbest, ete_err, spread);
+        } // end if(verbose)
+
+        // Termination Criterion
+        // a cycle of annealing ends when chains converge or temperature is frozen
+        cycleEnd = (ete != 0 && ete_err < ete) || (ere != 0 && ere_err < ere) || (tol != 0 && spread < tol) ||
+                   t < FROZEN * start;
+
+        if (cycleEnd) {
+            if (reheat == reheats) {
+                if (verbose) {
+                    printf("\nIn this step the last cycle of annealing ended,\n"
+                           "so the best point is the point on domain that minimum of the function happens.\n");
+                } // end if(verbose)
+
+                found = 1;
+                break;
+            } // end of if
+
+            // reheating, chains restart from the best point
+            reheat++;
+            t = start * pow(REHEATING, reheat);
+            for (unsigned int i = 0; i < size; ++i) {
+                for (unsigned int j = 0; j < n; ++j) {
+                    points[j * size + i] = best[j];
+                } // end of for loop
+                values[i] = fbest;
+            } // end of for loop
+
+            if (verbose) {
+                printf("\nReheating [#%d], temperature = %.5e .\n", reheat, t);
+            } // end if(verbose)
+        } else {
+            t *= COOLING;
+        } // end of if
+
+        step++;
+    } // end of while loop
+
+    for (unsigned int j = 0; j < n; ++j) {
+        x[j] = best[j];
+    } // end of for loop
+
+    for (int t = 0; t < threads; ++t) {
+        freeCompiledFunction(&functions[t]);
+    } // end of for loop
+    free(functions);
+    free(points);
+
+    // answer didn't found
+    if (!found) {
+        if (verbose) {
+            printf("\nThe annealing didn't end with the budget of %lu evaluations.\n"
+                   "the best calculated minimum is %lf .\n", budget, fbest);
+        } // end if(verbose)
+
+        // set state to 0 (false)
+        *state = 0;
+    } // end of if
+
+    return fbest;
+} // end of simulatedAnnealing function
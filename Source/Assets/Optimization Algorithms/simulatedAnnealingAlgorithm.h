@@ -0,0 +1,42 @@
+#ifndef C_MATH_SIMULATEDANNEALINGALGORITHM_H
+#define C_MATH_SIMULATEDANNEALINGALGORITHM_H
+
+#include <stdint.h>
+
+double simulatedAnnealing(const char *expression, unsigned int dimension, const double *lower, const double *upper,
+                          unsigned int chains, double temperature, unsigned int reheats, double ete, double ere,
+                          double tol, unsigned long int budget, uint64_t seed, double *x, int verbose, int *state);
+/*
+ * Simulated annealing finds the global minimum of f(x1, x2, ..., xn) inside a box. it runs a population of
+ * independent chains, in every step each chain proposes a random move whose length shrinks with temperature,
+ * and accepts it if it's better or with probability exp(-(f(new) - f(old)) / temperature), so at high
+ * temperature chains can climb out of local minima. temperature is multiplied by 0.98 in every step, and when
+ * chains converge or freeze, the temperature is reheated to half of the last reheating temperature and chains
+ * restart from the best point found, which explores around the best basin again. proposals of a step are
+ * evaluated in parallel batches, and all random numbers come from one generator, so a seed always gives
+ * the same result with any number of threads.
+ *
+ * ARGUMENTS:
+ * expressions  the function expression with arguments x1, x2, ..., xn like "sin(10*x1)*x1^2",
+ *              "x" can be used for a one argument function
+ * dimension    number of arguments of the function
+ * lower        array of size dimension, lower bounds of arguments
+ * upper        array of size dimension, upper bounds of arguments
+ * chains       number of chains
+ * temperature  initial temperature, or 0 to use standard deviation of function on the first chains
+ * reheats      maximum number of reheatings
+ * ete          estimated true error, compared with the largest width of chains along an argument
+ * ere          estimated relative error
+ * tol          tolerance error, compared with difference of function at the worst and the best chain
+ * budget       maximum number of function evaluations
+ * seed         seed of random generator
+ * x            array of size dimension, it receives the minimum
+ * verbose      show process {0: no, 1: yes}
+ * state        is answer found or not, will set value of state to 0 if the budget is used before the last cycle
+ *              of annealing ends
+ *
+ * RETURN:      value of function at the minimum
+ *
+ */
+
+#endif //C_MATH_SIMULATEDANNEALINGALGORITHM_H
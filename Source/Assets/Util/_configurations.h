@@ -4,4 +4,11 @@
 #define INPUT_SIZE 32
 #define DX 1e-6
 
+// number of samples generated and evaluated together in block based algorithms
+#define BLOCK_SIZE 1024
+// number of samples which use one independent random stream in parallel algorithms
+#define PARALLEL_CHUNK_SIZE 65536
+// maximum degree of polynomials which are solved by polynomial root finder
+#define POLYNOMIAL_MAX_DEGREE 128
+
 #endif //C_MATH_CONFIGURATIONS_H
@@ -4,6 +4,11 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 double function_1_arg(const char *expression, double valueX) {
     /*
@@ -54,3 +59,318 @@ double firstDerivative_1_arg(const char *expression, double x, double delta) {
 
     return (function_1_arg(expression, x + delta) - function_1_arg(expression, x - delta)) / (2 * delta);
 } // end of firstDerivative_1_arg
+
+
+static void compileBoundFunction(CompiledFunction *function, const char *expression, const char *const *names,
+                                 const unsigned int *slots, unsigned int count, unsigned int dimension) {
+    /*
+     * This function compiles an expression and binds every name to the storage of argument slots[i]
+     *
+     * ARGUMENTS:
+     * function     the compiled function to be initialized
+     * expressions  the function expression
+     * names        names of variables in expression
+     * slots        index of argument which is bound to every name
+     * count        number of names
+     * dimension    number of arguments of the function
+     */
+
+    // initializing variables
+    int err;
+    double *variables = (double *) calloc(dimension, sizeof(double));
+    te_variable *vars = (te_variable *) calloc(count, sizeof(te_variable));
+    char *lower = (char *) malloc(strlen(expression) + 1);
+
+    if (variables == NULL || vars == NULL || lower == NULL) {
+        printf("Unable to allocate memory!\n");
+        Exit(EXIT_FAILURE);
+    } // end of if
+
+    // lower the characters in a copy of expression, so string literals can be compiled
+    strcpy(lower, expression);
+    strToLower(lower);
+
+    // bind each name to it's storage
+    for (unsigned int i = 0; i < count; ++i) {
+        te_variable var = {names[i], {&variables[slots[i]]}, TE_VARIABLE, NULL};
+        memcpy(&vars[i], &var, sizeof(te_variable));
+    } // end of for loop
+
+    te_expr *equation = te_compile(lower, vars, (int) count, &err);
+
+    // names are only needed while compiling
+    free(vars);
+
+    if (equation) {
+        function->equation = equation;
+        function->variables = variables;
+        function->dimension = dimension;
+    } else { // Show the user where the error is at
+        printf("%s", lower);
+        printf("%*s^\nError near here\n", err - 1, "");
+        free(variables);
+        free(lower);
+        Exit(EXIT_FAILURE);
+    } // end of if
+
+    free(lower);
+} // end of compileBoundFunction
+
+
+void compileFunction_n_arg(CompiledFunction *function, const char *expression, unsigned int dimension) {
+    /*
+     * This function compiles an expression of a function with "dimension" arguments "f(x1, x2, ..., xn)"
+     * and binds the arguments to the storage of the compiled function
+     *
+     * ARGUMENTS:
+     * function     the compiled function to be initialized
+     * expressions  the function expression, it must be a string array like "x1^2+x2^2"
+     * dimension    number of arguments of the function
+     */
+
+    // check dimension
+    if (dimension == 0) {
+        printf("\nError: dimension of the function must be more than zero!\n");
+        Exit(EXIT_FAILURE);
+    } // end of if
+
+    // initializing variables
+    // one extra variable for "x" in one argument functions
+    unsigned int count = dimension == 1 ? 2 : dimension;
+    const char **names = (const char **) malloc(count * sizeof(char *));
+    unsigned int *slots = (unsigned int *) malloc(count * sizeof(unsigned int));
+    char *buffer = (char *) malloc(count * 16);
+
+    if (names == NULL || slots == NULL || buffer == NULL) {
+        printf("Unable to allocate memory!\n");
+        Exit(EXIT_FAILURE);
+    } // end of if
+
+    // name arguments x1, x2, ..., xn
+    for (unsigned int i = 0; i < dimension; ++i) {
+        sprintf(buffer + 16 * i, "x%u", i + 1);
+        names[i] = buffer + 16 * i;
+        slots[i] = i;
+    } // end of for loop
+
+    if (dimension == 1) {
+        names[1] = "x";
+        slots[1] = 0;
+    } // end of if
+
+    compileBoundFunction(function, expression, names, slots, count, dimension);
+
+    free(names);
+    free(slots);
+    free(buffer);
+} // end of compileFunction_n_arg
+
+
+void compileNamedFunction_n_arg(CompiledFunction *function, const char *expression, const char *const *names,
+                                unsigned int dimension) {
+    /*
+     * This function compiles an expression of a function with "dimension" arguments which have
+     * given names, like "x^3-p*x-1" with names {"x", "p"}, argument i is names[i]
+     *
+     * ARGUMENTS:
+     * function     the compiled function to be initialized
+     * expressions  the function expression
+     * names        array of size dimension, lower case names of arguments
+     * dimension    number of arguments of the function
+     */
+
+    // check dimension
+    if (dimension == 0) {
+        printf("\nError: dimension of the function must be more than zero!\n");
+        Exit(EXIT_FAILURE);
+    } // end of if
+
+    unsigned int *slots = (unsigned int *) malloc(dimension * sizeof(unsigned int));
+
+    if (slots == NULL) {
+        printf("Unable to allocate memory!\n");
+        Exit(EXIT_FAILURE);
+    } // end of if
+
+    for (unsigned int i = 0; i < dimension; ++i) {
+        slots[i] = i;
+    }
+
+    compileBoundFunction(function, expression, names, slots, dimension, dimension);
+
+    free(slots);
+} // end of compileNamedFunction_n_arg
+
+
+double compiledFunction_n_arg(const CompiledFunction *function, const double *point) {
+    /*
+     * This function evaluates a compiled function at the given point
+     *
+     * ARGUMENTS:
+     * function     the compiled function
+     * point        array of "dimension" values where the function must be evaluated
+     */
+
+    for (unsigned int i = 0; i < function->dimension; ++i) {
+        function->variables[i] = point[i];
+    }
+
+    return te_eval(function->equation);
+} // end of compiledFunction_n_arg
+
+
+void compiledFunctionBatch_n_arg(const CompiledFunction *function, const double *points, unsigned long int count,
+                                 unsigned long int stride, double *results) {
+    /*
+     * This function evaluates a compiled function on a block of points
+     *
+     * ARGUMENTS:
+     * function     the compiled function
+     * points       structure of arrays block, coordinate j of point i is points[j * stride + i]
+     * count        number of points in block
+     * stride       distance between two coordinates of a point, it must be at least count
+     * results      array of size count which receives the values of the function
+     */
+
+    const unsigned int dimension = function->dimension;
+    double *variables = function->variables;
+
+    for (unsigned long int i = 0; i < count; ++i) {
+        for (unsigned int j = 0; j < dimension; ++j) {
+            variables[j] = points[j * stride + i];
+        }
+        results[i] = te_eval(function->equation);
+    } // end of for loop
+} // end of compiledFunctionBatch_n_arg
+
+
+void compiledFunctionParallel_n_arg(const CompiledFunction *functions, int threads, const double *points,
+                                    unsigned long int count, double *results) {
+    /*
+     * This function evaluates a compiled function on a population of points in parallel, the points are split
+     * into one chunk for every thread, so even a small population (like 10 * dimension members of an optimizer)
+     * uses all threads
+     *
+     * ARGUMENTS:
+     * functions    array of size threads, every thread evaluates it's own copy of the compiled function
+     * threads      number of threads
+     * points       structure of arrays, coordinate j of point i is points[j * count + i]
+     * count        number of points
+     * results      array of size count which receives the values of the function
+     */
+
+    // chunks are loop iterations, so every chunk is evaluated even if OpenMP gives less threads than requested
+    const unsigned long int chunk = (count + threads - 1) / threads;
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) num_threads(threads)
+#endif
+    for (int c = 0; c < threads; ++c) {
+#ifdef _OPENMP
+        int id = omp_get_thread_num();
+#else
+        int id = 0;
+#endif
+        const unsigned long int first = (unsigned long int) c * chunk;
+
+        if (first < count) {
+            compiledFunctionBatch_n_arg(&functions[id], points + first, count - first < chunk ? count - first : chunk,
+                                        count, results + first);
+        } // end of if
+    } // end of parallel for loop
+} // end of compiledFunctionParallel_n_arg
+
+
+double compiledGradient_n_arg(const CompiledFunction *function, const double *point, double *gradient) {
+    /*
+     * This function evaluates a compiled function and it's gradient at the given point,
+     * the gradient is calculated by automatic differentiation of the expression
+     *
+     * ARGUMENTS:
+     * function     the compiled function
+     * point        array of "dimension" values where the function must be evaluated
+     * gradient     array of size "dimension" which receives the partial derivatives
+     */
+
+    for (unsigned int i = 0; i < function->dimension; ++i) {
+        function->variables[i] = point[i];
+    }
+
+    return te_gradient(function->equation, function->variables, (int) function->dimension, gradient);
+} // end of compiledGradient_n_arg
+
+
+int compiledInterval_n_arg(const CompiledFunction *function, const double *lower, const double *upper,
+                           double *low, double *high) {
+    /*
+     * This function bounds a compiled function on a box by interval arithmetic,
+     * rounding errors are covered by moving the bounds outward
+     *
+     * ARGUMENTS:
+     * function     the compiled function
+     * lower        array of "dimension" values, lower bounds of arguments
+     * upper        array of "dimension" values, upper bounds of arguments
+     * low          receives a lower bound of the function on the box
+     * high         receives an upper bound of the function on the box
+     *
+     * RETURN:      1 if the bounds are found, 0 if the function has no interval rule
+     */
+
+    return te_interval(function->equation, function->variables, (int) function->dimension, lower, upper, low, high);
+} // end of compiledInterval_n_arg
+
+
+void freeCompiledFunction(CompiledFunction *function) {
+    te_free(function->equation);
+    free(function->variables);
+    function->equation = NULL;
+    function->variables = NULL;
+    function->dimension = 0;
+} // end of freeCompiledFunction
+
+
+int polynomialCoefficients_1_arg(const char *expression, double *coefficients, unsigned int maxDegree) {
+    /*
+     * This function checks if a one argument function "f(x)" is a polynomial and finds it's coefficients,
+     * expressions made of numbers, x, +, -, *, division by constants and constant integer powers are polynomials
+     *
+     * ARGUMENTS:
+     * expressions  the function expression, it must be a string array like "x^3-2*x+1"
+     * coefficients array of size maxDegree + 1, coefficients[i] will be the coefficient of x^i
+     * maxDegree    maximum degree of polynomial to be accepted
+     *
+     * RETURN:      degree of the polynomial, or -1 if it's not a polynomial of degree at most maxDegree
+     */
+
+    // initializing variables
+    double x;
+    int err;
+    char *lower = (char *) malloc(strlen(expression) + 1);
+
+    if (lower == NULL) {
+        printf("Unable to allocate memory!\n");
+        Exit(EXIT_FAILURE);
+    } // end of if
+
+    // lower the characters in a copy of expression
+    strcpy(lower, expression);
+    strToLower(lower);
+
+    te_variable vars[] = {{"x", {&x}, TE_VARIABLE, NULL}};
+    te_expr *equation = te_compile(lower, vars, 1, &err);
+
+    if (equation) {
+        int degree = te_polynomial(equation, &x, coefficients, (int) maxDegree);
+        te_free(equation);
+        free(lower);
+        return degree;
+    } else { // Show the user where the error is at
+        printf("%s", lower);
+        printf("%*s^\nError near here\n", err - 1, "");
+        free(lower);
+        Exit(EXIT_FAILURE);
+    } // end of if
+
+    // it shouldn't reach this block of code, but however I write a return statement
+    return -1;
+} // end of polynomialCoefficients_1_arg
@@ -1,8 +1,70 @@
 #ifndef C_MATH_FUNCTIONS_H
 #define C_MATH_FUNCTIONS_H
 
+struct te_expr;
+
+typedef struct {
+    struct te_expr *equation;
+    double *variables;
+    unsigned int dimension;
+} CompiledFunction;
+
 double function_1_arg(const char *expression, double value);
 
 double firstDerivative_1_arg(const char *expression, double x, double delta);
 
+void compileFunction_n_arg(CompiledFunction *function, const char *expression, unsigned int dimension);
+/*
+ * Compiles an expression of a function with "dimension" arguments once, so it can be evaluated
+ * many times without parsing the string again. arguments are named x1, x2, ..., xn and
+ * for a one argument function "x" can be used as well.
+ * every thread must own it's own compiled function, because arguments are bound to it's storage.
+ */
+
+void compileNamedFunction_n_arg(CompiledFunction *function, const char *expression, const char *const *names,
+                                unsigned int dimension);
+/*
+ * Compiles an expression of a function with "dimension" arguments which have given names,
+ * like "x^3-p*x-1" with names {"x", "p"}, argument i is names[i]
+ */
+
+double compiledFunction_n_arg(const CompiledFunction *function, const double *point);
+
+void compiledFunctionBatch_n_arg(const CompiledFunction *function, const double *points, unsigned long int count,
+                                 unsigned long int stride, double *results);
+/*
+ * Evaluates a block of "count" points stored as structure of arrays,
+ * coordinate j of point i is points[j * stride + i], and writes f(point i) to results[i]
+ */
+
+void compiledFunctionParallel_n_arg(const CompiledFunction *functions, int threads, const double *points,
+                                    unsigned long int count, double *results);
+/*
+ * Evaluates a population of "count" points stored as structure of arrays (stride is count) in parallel,
+ * the points are split into one chunk for every thread and thread t uses functions[t]
+ */
+
+double compiledGradient_n_arg(const CompiledFunction *function, const double *point, double *gradient);
+/*
+ * Evaluates a compiled function at a point and writes it's gradient, partial derivative i to gradient[i],
+ * the derivatives are exact for arithmetic and elementary functions (automatic differentiation)
+ */
+
+int compiledInterval_n_arg(const CompiledFunction *function, const double *lower, const double *upper,
+                           double *low, double *high);
+/*
+ * Writes an interval [low, high] which certainly contains f(point) for every point of the box
+ * lower[i] <= xi <= upper[i] (interval arithmetic), low > high means f is not defined in the box,
+ * returns 0 and [-inf, inf] if the expression has a function without a known interval rule
+ */
+
+void freeCompiledFunction(CompiledFunction *function);
+
+int polynomialCoefficients_1_arg(const char *expression, double *coefficients, unsigned int maxDegree);
+/*
+ * Checks if a one argument function "f(x)" is a polynomial and writes it's coefficients,
+ * coefficients[i] is the coefficient of x^i. returns degree of the polynomial,
+ * or -1 if it's not a polynomial of degree at most maxDegree
+ */
+
 #endif //C_MATH_FUNCTIONS_H
@@ -726,4 +726,426 @@ static void pn (const te_expr *n, int depth) {
 
 void te_print(const te_expr *n) {
     pn(n, 0);
-}
\ No newline at end of file
+}
+
+static int te_degree(const double *c, int max_degree) {
+    int degree = max_degree;
+    while (degree > 0 && c[degree] == 0) --degree;
+    return degree;
+}
+
+int te_polynomial(const te_expr *n, const double *variable, double *coefficients, int max_degree) {
+    int i, j, da, db, ret = -1;
+    double *a, *b;
+
+    for (i = 0; i <= max_degree; ++i) coefficients[i] = 0;
+    if (!n) return -1;
+
+    switch (TYPE_MASK(n->type)) {
+        case TE_CONSTANT:
+            coefficients[0] = n->v.value;
+            return 0;
+
+        case TE_VARIABLE:
+            if (n->v.bound != variable) return -1;
+            if (max_degree < 1) return -1;
+            coefficients[1] = 1;
+            return 1;
+
+        case TE_FUNCTION0:
+            /* Constants like pi and e. */
+            if (!IS_PURE(n->type)) return -1;
+            coefficients[0] = te_eval(n);
+            return 0;
+
+        case TE_FUNCTION1:
+            if (n->v.f.f1 != negate) return -1;
+            da = te_polynomial(n->parameters[0], variable, coefficients, max_degree);
+            for (i = 0; i <= max_degree; ++i) coefficients[i] = -coefficients[i];
+            return da;
+
+        case TE_FUNCTION2:
+            if (n->v.f.f2 != add && n->v.f.f2 != sub && n->v.f.f2 != mul &&
+                n->v.f.f2 != divide && n->v.f.f2 != pow) return -1;
+
+            a = malloc(2 * (max_degree + 1) * sizeof(double));
+            if (!a) return -1;
+            b = a + max_degree + 1;
+
+            da = te_polynomial(n->parameters[0], variable, a, max_degree);
+            db = te_polynomial(n->parameters[1], variable, b, max_degree);
+
+            if (da < 0 || db < 0) {
+                ret = -1;
+            } else if (n->v.f.f2 == add || n->v.f.f2 == sub) {
+                for (i = 0; i <= max_degree; ++i) {
+                    coefficients[i] = n->v.f.f2 == add ? a[i] + b[i] : a[i] - b[i];
+                }
+                ret = te_degree(coefficients, max_degree);
+            } else if (n->v.f.f2 == mul) {
+                if (da + db <= max_degree) {
+                    for (i = 0; i <= da; ++i)
+                        for (j = 0; j <= db; ++j)
+                            coefficients[i + j] += a[i] * b[j];
+                    ret = te_degree(coefficients, max_degree);
+                }
+            } else if (n->v.f.f2 == divide) {
+                /* Only division by a constant keeps a polynomial. */
+                if (db == 0 && b[0] != 0) {
+                    for (i = 0; i <= da; ++i) coefficients[i] = a[i] / b[0];
+                    ret = da;
+                }
+            } else {
+                /* Only a non-negative integer constant power keeps a polynomial. */
+                /* Range is checked before the conversion, (int) of a large or nan exponent is undefined. */
+                const int k = db == 0 && b[0] >= 0 && b[0] <= max_degree && b[0] == floor(b[0]) ? (int) b[0] : -1;
+                int p;
+                if (k >= 0 && (long) da * k <= max_degree) {
+                    coefficients[0] = 1;
+                    ret = 0;
+                    for (p = 0; p < k; ++p) {
+                        for (i = ret + da; i >= 0; --i) {
+                            double sum = 0;
+                            for (j = 0; j <= da && j <= i; ++j) sum += a[j] * coefficients[i - j];
+                            coefficients[i] = sum;
+                        }
+                        ret += da;
+                    }
+                    ret = te_degree(coefficients, max_degree);
+                }
+            }
+
+            free(a);
+            return ret;
+
+        default:
+            return -1;
+    }
+}
+
+static double te_call(const te_expr *n, const double *a) {
+    /* Calls the function of the node with the given argument values. */
+    switch (TYPE_MASK(n->type)) {
+        case TE_FUNCTION1: return n->v.f.f1(a[0]);
+        case TE_FUNCTION2: return n->v.f.f2(a[0], a[1]);
+        case TE_FUNCTION3: return n->v.f.f3(a[0], a[1], a[2]);
+        case TE_FUNCTION4: return n->v.f.f4(a[0], a[1], a[2], a[3]);
+        case TE_FUNCTION5: return n->v.f.f5(a[0], a[1], a[2], a[3], a[4]);
+        case TE_FUNCTION6: return n->v.f.f6(a[0], a[1], a[2], a[3], a[4], a[5]);
+        case TE_FUNCTION7: return n->v.f.f7(a[0], a[1], a[2], a[3], a[4], a[5], a[6]);
+        case TE_CLOSURE1: return n->v.f.cl1(n->parameters[1], a[0]);
+        case TE_CLOSURE2: return n->v.f.cl2(n->parameters[2], a[0], a[1]);
+        case TE_CLOSURE3: return n->v.f.cl3(n->parameters[3], a[0], a[1], a[2]);
+        case TE_CLOSURE4: return n->v.f.cl4(n->parameters[4], a[0], a[1], a[2], a[3]);
+        case TE_CLOSURE5: return n->v.f.cl5(n->parameters[5], a[0], a[1], a[2], a[3], a[4]);
+        case TE_CLOSURE6: return n->v.f.cl6(n->parameters[6], a[0], a[1], a[2], a[3], a[4], a[5]);
+        case TE_CLOSURE7: return n->v.f.cl7(n->parameters[7], a[0], a[1], a[2], a[3], a[4], a[5], a[6]);
+        default: return NAN;
+    }
+}
+
+static int te_partials(const te_expr *n, const double *a, double *d) {
+    /* Writes exact partial derivatives of the node's function with respect to it's arguments. */
+    /* Returns 0 if the function has no known rule. */
+    if (TYPE_MASK(n->type) == TE_FUNCTION1) {
+        double (*f)(double) = n->v.f.f1;
+        const double x = a[0];
+        if (f == negate) d[0] = -1;
+        else if (f == fabs) d[0] = x > 0 ? 1 : (x < 0 ? -1 : 0);
+        else if (f == ceil_ || f == floor_) d[0] = 0;
+        else if (f == sin) d[0] = cos(x);
+        else if (f == cos) d[0] = -sin(x);
+        else if (f == tan) d[0] = 1 + tan(x) * tan(x);
+        else if (f == asin) d[0] = 1 / sqrt(1 - x * x);
+        else if (f == acos) d[0] = -1 / sqrt(1 - x * x);
+        else if (f == atan) d[0] = 1 / (1 + x * x);
+        else if (f == sinh) d[0] = cosh(x);
+        else if (f == cosh) d[0] = sinh(x);
+        else if (f == tanh) d[0] = 1 - tanh(x) * tanh(x);
+        else if (f == exp) d[0] = exp(x);
+        else if (f == log) d[0] = 1 / x;
+        else if (f == log10) d[0] = 1 / (x * log(10.0));
+        else if (f == sqrt) d[0] = 0.5 / sqrt(x);
+        else return 0;
+        return 1;
+    }
+
+    if (TYPE_MASK(n->type) == TE_FUNCTION2) {
+        double (*f)(double, double) = n->v.f.f2;
+        const double x = a[0], y = a[1];
+        if (f == add) {d[0] = 1; d[1] = 1;}
+        else if (f == sub) {d[0] = 1; d[1] = -1;}
+        else if (f == mul) {d[0] = y; d[1] = x;}
+        else if (f == divide) {d[0] = 1 / y; d[1] = -x / (y * y);}
+        else if (f == comma) {d[0] = 0; d[1] = 1;}
+        else if (f == atan2) {d[0] = y / (x * x + y * y); d[1] = -x / (x * x + y * y);}
+        else if (f == fmod) {d[0] = 1; d[1] = -trunc(x / y);}
+        else if (f == pow) {
+            d[0] = y == 0 ? 0 : y * pow(x, y - 1);
+            d[1] = x > 0 ? pow(x, y) * log(x) : (x == 0 ? 0 : NAN);
+        }
+        else return 0;
+        return 1;
+    }
+
+    return 0;
+}
+
+static void te_adjoint(const te_expr *n, double adjoint, const double *variables, int count, double *gradient) {
+    /* Reverse mode, adds adjoint * d(node)/d(variable i) to gradient[i]. */
+    double a[7] = {0}, d[7];
+    int i, arity;
+
+    switch (TYPE_MASK(n->type)) {
+        case TE_VARIABLE:
+            for (i = 0; i < count; ++i) {
+                if (n->v.bound == variables + i) {
+                    gradient[i] += adjoint;
+                    break;
+                }
+            }
+            return;
+
+        case TE_FUNCTION1: case TE_FUNCTION2: case TE_FUNCTION3:
+        case TE_FUNCTION4: case TE_FUNCTION5: case TE_FUNCTION6: case TE_FUNCTION7:
+        case TE_CLOSURE1: case TE_CLOSURE2: case TE_CLOSURE3:
+        case TE_CLOSURE4: case TE_CLOSURE5: case TE_CLOSURE6: case TE_CLOSURE7:
+            arity = ARITY(n->type);
+            for (i = 0; i < arity; ++i) a[i] = te_eval(n->parameters[i]);
+
+            if (!te_partials(n, a, d)) {
+                /* No rule is known, so the partial derivatives are central differences. */
+                for (i = 0; i < arity; ++i) {
+                    const double x = a[i], h = 1e-6 * (1 + fabs(x));
+                    double forward, backward;
+                    a[i] = x + h;
+                    forward = te_call(n, a);
+                    a[i] = x - h;
+                    backward = te_call(n, a);
+                    a[i] = x;
+                    d[i] = (forward - backward) / (2 * h);
+                }
+            }
+
+            for (i = 0; i < arity; ++i) te_adjoint(n->parameters[i], adjoint * d[i], variables, count, gradient);
+            return;
+
+        default:
+            /* Constants don't depend on variables. */
+            return;
+    }
+}
+
+double te_gradient(const te_expr *n, const double *variables, int count, double *gradient) {
+    int i;
+    for (i = 0; i < count; ++i) gradient[i] = 0;
+    if (!n) return NAN;
+
+    te_adjoint(n, 1, variables, count, gradient);
+    return te_eval(n);
+}
+
+/* Interval [l, h] is empty when l > h, like the range of sqrt on negative numbers. */
+#define EMPTY(l, h) (!((l) <= (h)))
+
+static void te_outward(double *l, double *h, int ulps) {
+    /* Moves bounds outward to cover rounding errors of the operation. */
+    int i;
+    for (i = 0; i < ulps; ++i) {
+        *l = nextafter(*l, -INFINITY);
+        *h = nextafter(*h, INFINITY);
+    }
+}
+
+static void te_hull(const double *v, int count, double *l, double *h) {
+    /* Smallest interval containing the values, not a number means the bounds are unknown. */
+    int i;
+    *l = INFINITY;
+    *h = -INFINITY;
+    for (i = 0; i < count; ++i) {
+        if (isnan(v[i])) {*l = -INFINITY; *h = INFINITY; return;}
+        if (v[i] < *l) *l = v[i];
+        if (v[i] > *h) *h = v[i];
+    }
+}
+
+static void te_periodic(double (*f)(double), double l, double h, double top, double bottom, double *rl, double *rh) {
+    /* Range of sin or cos, top and bottom are the first maximum and minimum after zero. */
+    const double period = 2 * pi();
+    double v[2];
+
+    if (h - l >= period || fabs(l) > 1e8 || fabs(h) > 1e8) {*rl = -1; *rh = 1; return;}
+
+    v[0] = f(l);
+    v[1] = f(h);
+    te_hull(v, 2, rl, rh);
+    if (top + period * ceil((l - top) / period) <= h) *rh = 1;
+    if (bottom + period * ceil((l - bottom) / period) <= h) *rl = -1;
+
+    /* A maximum or minimum slightly missed by rounding changes the range much less than 1e-14. */
+    *rl = fmax(*rl - 1e-14, -1);
+    *rh = fmin(*rh + 1e-14, 1);
+}
+
+static void te_power(double l, double h, double k, double *rl, double *rh) {
+    /* Range of x^k for an integer k. */
+    const double a = pow(l, k), b = pow(h, k);
+
+    if (k == 0) {*rl = 1; *rh = 1; return;}
+    if (k < 0) {
+        double pl, ph;
+        te_power(l, h, -k, &pl, &ph);
+        if (pl <= 0 && ph >= 0) {*rl = -INFINITY; *rh = INFINITY; return;}
+        *rl = 1 / ph;
+        *rh = 1 / pl;
+    } else if (fmod(k, 2) == 0) {
+        *rl = l <= 0 && h >= 0 ? 0 : fmin(a, b);
+        *rh = fmax(a, b);
+    } else {
+        *rl = a;
+        *rh = b;
+    }
+    te_outward(rl, rh, 2);
+}
+
+static int te_bounds(const te_expr *n, const double *variables, int count, const double *lower, const double *upper,
+                     double *l, double *h) {
+    /* Writes an interval containing the node's values, returns 0 if a function has no known rule. */
+    double al, ah, bl, bh, v[4];
+    int i;
+
+    switch (TYPE_MASK(n->type)) {
+        case TE_CONSTANT:
+            *l = *h = n->v.value;
+            return 1;
+
+        case TE_VARIABLE:
+            for (i = 0; i < count; ++i) {
+                if (n->v.bound == variables + i) {*l = lower[i]; *h = upper[i]; return 1;}
+            }
+            *l = *h = *n->v.bound;
+            return 1;
+
+        case TE_FUNCTION0:
+            if (!IS_PURE(n->type)) return 0;
+            *l = *h = te_eval(n);
+            return 1;
+
+        case TE_FUNCTION1: {
+            double (*f)(double) = n->v.f.f1;
+            if (!te_bounds(n->parameters[0], variables, count, lower, upper, &al, &ah)) return 0;
+            if (EMPTY(al, ah)) {*l = al; *h = ah; return 1;}
+
+            if (f == negate) {*l = -ah; *h = -al; return 1;}
+            if (f == ceil_ || f == floor_) {*l = f(al); *h = f(ah); return 1;}
+            if (f == fabs) {
+                *l = al <= 0 && ah >= 0 ? 0 : fmin(fabs(al), fabs(ah));
+                *h = fmax(fabs(al), fabs(ah));
+                return 1;
+            }
+            if (f == sin) {te_periodic(sin, al, ah, pi() / 2, -pi() / 2, l, h); return 1;}
+            if (f == cos) {te_periodic(cos, al, ah, 0, -pi(), l, h); return 1;}
+
+            if (f == tan) {
+                const double half = pi() / 2;
+                if (ah - al >= 2 * half || fabs(al) > 1e8 || fabs(ah) > 1e8 ||
+                    half + 2 * half * ceil((al - half) / (2 * half)) <= ah + 1e-9) {
+                    *l = -INFINITY;
+                    *h = INFINITY;
+                    return 1;
+                }
+                *l = tan(al);
+                *h = tan(ah);
+            } else if (f == cosh) {
+                *l = al <= 0 && ah >= 0 ? 1 : fmin(cosh(al), cosh(ah));
+                *h = fmax(cosh(al), cosh(ah));
+            } else if (f == exp || f == sinh || f == tanh || f == atan) {
+                *l = f(al);
+                *h = f(ah);
+            } else if (f == sqrt || f == log || f == log10) {
+                /* Only the part of interval inside the domain matters. */
+                if (ah < 0) {*l = INFINITY; *h = -INFINITY; return 1;}
+                *l = f(fmax(al, 0));
+                *h = f(ah);
+            } else if (f == asin || f == acos) {
+                if (ah < -1 || al > 1) {*l = INFINITY; *h = -INFINITY; return 1;}
+                v[0] = f(fmax(al, -1));
+                v[1] = f(fmin(ah, 1));
+                te_hull(v, 2, l, h);
+            } else {
+                return 0;
+            }
+
+            te_outward(l, h, 2);
+            return 1;
+        }
+
+        case TE_FUNCTION2: {
+            double (*f)(double, double) = n->v.f.f2;
+            if (!te_bounds(n->parameters[0], variables, count, lower, upper, &al, &ah)) return 0;
+            if (!te_bounds(n->parameters[1], variables, count, lower, upper, &bl, &bh)) return 0;
+            if (EMPTY(al, ah)) {*l = al; *h = ah; return 1;}
+            if (EMPTY(bl, bh)) {*l = bl; *h = bh; return 1;}
+
+            if (f == comma) {*l = bl; *h = bh; return 1;}
+
+            if (f == add) {
+                v[0] = al + bl;
+                v[1] = ah + bh;
+                te_hull(v, 2, l, h);
+            } else if (f == sub) {
+                v[0] = al - bh;
+                v[1] = ah - bl;
+                te_hull(v, 2, l, h);
+            } else if (f == mul) {
+                v[0] = al * bl; v[1] = al * bh; v[2] = ah * bl; v[3] = ah * bh;
+                te_hull(v, 4, l, h);
+            } else if (f == divide) {
+                if (bl <= 0 && bh >= 0) {*l = -INFINITY; *h = INFINITY; return 1;}
+                v[0] = al / bl; v[1] = al / bh; v[2] = ah / bl; v[3] = ah / bh;
+                te_hull(v, 4, l, h);
+            } else if (f == fmod) {
+                /* Remainder has the sign of x and is smaller than y. */
+                const double m = fmax(fabs(bl), fabs(bh));
+                *l = al >= 0 ? 0 : -m;
+                *h = ah <= 0 ? 0 : m;
+                return 1;
+            } else if (f == atan2) {
+                *l = -pi();
+                *h = pi();
+            } else if (f == pow) {
+                if (bl == bh && bl == floor(bl) && fabs(bl) < 1e9) {
+                    te_power(al, ah, bl, l, h);
+                    return 1;
+                }
+                if (bl == bh && ah < 0) {*l = INFINITY; *h = -INFINITY; return 1;}
+                if (al < 0 && bl != bh) {*l = -INFINITY; *h = INFINITY; return 1;}
+
+                /* x^y = exp(y * ln(x)) is monotonic in both arguments for positive x. */
+                al = fmax(al, 0);
+                v[0] = pow(al, bl); v[1] = pow(al, bh); v[2] = pow(ah, bl); v[3] = pow(ah, bh);
+                te_hull(v, 4, l, h);
+            } else {
+                return 0;
+            }
+
+            te_outward(l, h, 2);
+            return 1;
+        }
+
+        default:
+            return 0;
+    }
+}
+
+#undef EMPTY
+
+int te_interval(const te_expr *n, const double *variables, int count, const double *lower, const double *upper,
+                double *low, double *high) {
+    if (!n || !te_bounds(n, variables, count, lower, upper, low, high)) {
+        *low = -INFINITY;
+        *high = INFINITY;
+        return 0;
+    }
+    return 1;
+}
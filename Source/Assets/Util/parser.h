@@ -111,6 +111,23 @@ te_expr *te_compile(const char *expression, const te_variable *variables, int va
 /* Evaluates the expression. */
 double te_eval(const te_expr *n);
 
+/* Writes coefficients of the expression as a polynomial in the variable bound to "variable", */
+/* lowest degree first, and returns it's degree. */
+/* Returns -1 if the expression is not a polynomial of degree at most max_degree. */
+int te_polynomial(const te_expr *n, const double *variable, double *coefficients, int max_degree);
+
+/* Writes gradient of the expression with respect to the variables bound to variables[0 .. count - 1] */
+/* by reverse mode automatic differentiation, and returns value of the expression. */
+/* Functions without a known derivative rule are differentiated by central differences. */
+double te_gradient(const te_expr *n, const double *variables, int count, double *gradient);
+
+/* Writes an interval [low, high] containing all values of the expression when variables bound to */
+/* variables[0 .. count - 1] change in [lower[i], upper[i]], by interval arithmetic with outward rounding. */
+/* low > high means the expression is not defined anywhere in the box. Returns 0 and the whole real line */
+/* if the expression has a function without a known interval rule. */
+int te_interval(const te_expr *n, const double *variables, int count, const double *lower, const double *upper,
+                double *low, double *high);
+
 /* Prints debugging information on the syntax tree. */
 void te_print(const te_expr *n);
 
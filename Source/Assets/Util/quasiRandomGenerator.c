@@ -0,0 +1,184 @@
+#include "quasiRandomGenerator.h"
+#include "randomGenerator.h"
+#include "util.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+// primitive polynomials and initial direction numbers of Joe and Kuo (new-joe-kuo-6.21201)
+// for dimensions 2 to SOBOL_MAX_DIMENSION, every row is {s, a, m1, m2, ..., ms}
+static const unsigned int sobolPolynomials[SOBOL_MAX_DIMENSION - 1][9] = {
+        {1, 0,  1},
+        {2, 1,  1, 3},
+        {3, 1,  1, 3, 1},
+        {3, 2,  1, 1, 1},
+        {4, 1,  1, 1, 3, 3},
+        {4, 4,  1, 3, 5, 13},
+        {5, 2,  1, 1, 5, 5,  17},
+        {5, 4,  1, 1, 5, 5,  5},
+        {5, 7,  1, 1, 7, 11, 19},
+        {5, 11, 1, 1, 5, 1,  1},
+        {5, 13, 1, 1, 1, 3,  11},
+        {5, 14, 1, 3, 5, 5,  31},
+        {6, 1,  1, 3, 3, 9,  7,  49},
+        {6, 13, 1, 1, 1, 15, 21, 21},
+        {6, 16, 1, 3, 1, 13, 27, 49},
+        {6, 19, 1, 1, 1, 15, 7,  5},
+        {6, 22, 1, 3, 1, 15, 13, 25},
+        {6, 25, 1, 1, 5, 5,  19, 61},
+        {7, 1,  1, 3, 7, 11, 23, 15, 103},
+        {7, 4,  1, 3, 7, 13, 13, 15, 69}
+};
+
+static const unsigned int haltonPrimes[HALTON_MAX_DIMENSION] = {
+        2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37, 41, 43, 47, 53,
+        59, 61, 67, 71, 73, 79, 83, 89, 97, 101, 103, 107, 109, 113, 127, 131
+};
+
+void initSobolSequence(SobolSequence *sequence, unsigned int dimension) {
+    /*
+     * Initialize a Sobol low discrepancy sequence of given dimension using Joe-Kuo direction numbers
+     *
+     * ARGUMENTS:
+     * sequence     the sequence to be initialized
+     * dimension    number of coordinates of every point
+     */
+
+    // check dimension
+    if (dimension == 0 || dimension > SOBOL_MAX_DIMENSION) {
+        printf("\nError: dimension of Sobol sequence must be between 1 and %d!\n", SOBOL_MAX_DIMENSION);
+        Exit(EXIT_FAILURE);
+    } // end of if
+
+    sequence->dimension = dimension;
+    sequence->index = 0;
+
+    // first dimension is van der Corput sequence in base 2
+    for (unsigned int i = 0; i < 32; ++i) {
+        sequence->directions[0][i] = (uint32_t) 1 << (31 - i);
+    }
+
+    for (unsigned int j = 1; j < dimension; ++j) {
+        const unsigned int *polynomial = sobolPolynomials[j - 1];
+        unsigned int s = polynomial[0], a = polynomial[1];
+        uint32_t *v = sequence->directions[j];
+
+        // initial direction numbers come from the table
+        for (unsigned int i = 0; i < s; ++i) {
+            v[i] = (uint32_t) polynomial[2 + i] << (31 - i);
+        }
+
+        // rest of them come from the recurrence relation of the primitive polynomial
+        for (unsigned int i = s; i < 32; ++i) {
+            v[i] = v[i - s] ^ (v[i - s] >> s);
+            for (unsigned int k = 1; k < s; ++k) {
+                v[i] ^= ((a >> (s - 1 - k)) & 1u) * v[i - k];
+            }
+        } // end of for loop
+    } // end of for loop
+
+    for (unsigned int j = 0; j < dimension; ++j) {
+        sequence->state[j] = 0;
+        sequence->shift[j] = 0;
+    }
+} // end of initSobolSequence
+
+void shiftSobolSequence(SobolSequence *sequence) {
+    /*
+     * Restart the sequence with a new random digital shift
+     */
+
+    sequence->index = 0;
+    for (unsigned int j = 0; j < sequence->dimension; ++j) {
+        sequence->state[j] = 0;
+        // uniform over all 32 bits, zeroToOneUniformRandom has 53 random bits in [0, 1)
+        sequence->shift[j] = (uint32_t) (zeroToOneUniformRandom() * 4294967296.0);
+    }
+} // end of shiftSobolSequence
+
+void nextSobolPoint(SobolSequence *sequence, double *point) {
+    /*
+     * Write next point of the sequence to point array, using gray code order
+     * so every point only needs one XOR per coordinate
+     */
+
+    for (unsigned int j = 0; j < sequence->dimension; ++j) {
+        point[j] = (double) (sequence->state[j] ^ sequence->shift[j]) / 4294967296.0;
+    }
+
+    // find the rightmost zero bit of index
+    unsigned long int index = sequence->index++;
+    unsigned int c = 0;
+    while (index & 1ul) {
+        index >>= 1;
+        c++;
+    }
+
+    // guard against the end of the sequence, 2^32 points
+    if (c > 31) {
+        c = 31;
+    }
+
+    for (unsigned int j = 0; j < sequence->dimension; ++j) {
+        sequence->state[j] ^= sequence->directions[j][c];
+    }
+} // end of nextSobolPoint
+
+void initHaltonSequence(HaltonSequence *sequence, unsigned int dimension) {
+    /*
+     * Initialize a Halton low discrepancy sequence of given dimension
+     *
+     * ARGUMENTS:
+     * sequence     the sequence to be initialized
+     * dimension    number of coordinates of every point
+     */
+
+    // check dimension
+    if (dimension == 0 || dimension > HALTON_MAX_DIMENSION) {
+        printf("\nError: dimension of Halton sequence must be between 1 and %d!\n", HALTON_MAX_DIMENSION);
+        Exit(EXIT_FAILURE);
+    } // end of if
+
+    sequence->dimension = dimension;
+    // point zero is the origin in every dimension, so skip it
+    sequence->index = 1;
+    for (unsigned int j = 0; j < dimension; ++j) {
+        sequence->shift[j] = 0;
+    }
+} // end of initHaltonSequence
+
+void shiftHaltonSequence(HaltonSequence *sequence) {
+    /*
+     * Restart the sequence with a new random shift modulo one
+     */
+
+    sequence->index = 1;
+    for (unsigned int j = 0; j < sequence->dimension; ++j) {
+        sequence->shift[j] = zeroToOneUniformRandom();
+    }
+} // end of shiftHaltonSequence
+
+void nextHaltonPoint(HaltonSequence *sequence, double *point) {
+    /*
+     * Write next point of the sequence to point array, coordinate j is the radical inverse
+     * of index in base of j-th prime number
+     */
+
+    for (unsigned int j = 0; j < sequence->dimension; ++j) {
+        unsigned long int index = sequence->index;
+        unsigned int base = haltonPrimes[j];
+        double factor = 1.0 / base, x = 0;
+
+        while (index > 0) {
+            x += factor * (double) (index % base);
+            index /= base;
+            factor /= base;
+        }
+
+        // shift modulo one
+        x += sequence->shift[j];
+        point[j] = x >= 1 ? x - 1 : x;
+    } // end of for loop
+
+    sequence->index++;
+} // end of nextHaltonPoint
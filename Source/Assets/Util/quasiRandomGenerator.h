@@ -0,0 +1,56 @@
+#ifndef C_MATH_QUASIRANDOMGENERATOR_H
+#define C_MATH_QUASIRANDOMGENERATOR_H
+
+#include <stdint.h>
+
+#define SOBOL_MAX_DIMENSION 21
+#define HALTON_MAX_DIMENSION 32
+
+typedef struct {
+    unsigned int dimension;
+    unsigned long int index;
+    uint32_t directions[SOBOL_MAX_DIMENSION][32];
+    uint32_t state[SOBOL_MAX_DIMENSION];
+    uint32_t shift[SOBOL_MAX_DIMENSION];
+} SobolSequence;
+
+typedef struct {
+    unsigned int dimension;
+    unsigned long int index;
+    double shift[HALTON_MAX_DIMENSION];
+} HaltonSequence;
+
+void initSobolSequence(SobolSequence *sequence, unsigned int dimension);
+/*
+ * Initialize a Sobol low discrepancy sequence of given dimension (at most SOBOL_MAX_DIMENSION)
+ * using Joe-Kuo direction numbers, the sequence starts from point zero without any shift
+ */
+
+void shiftSobolSequence(SobolSequence *sequence);
+/*
+ * Restart the sequence with a new random digital shift (XOR of a random 32 bit number
+ * in every dimension), every shifted sequence is an independent randomization of the same point set
+ */
+
+void nextSobolPoint(SobolSequence *sequence, double *point);
+/*
+ * Write next point of the sequence to point array of size dimension, every coordinate is in [0, 1)
+ */
+
+void initHaltonSequence(HaltonSequence *sequence, unsigned int dimension);
+/*
+ * Initialize a Halton low discrepancy sequence of given dimension (at most HALTON_MAX_DIMENSION)
+ * using first prime numbers as bases, the sequence starts from point one without any shift
+ */
+
+void shiftHaltonSequence(HaltonSequence *sequence);
+/*
+ * Restart the sequence with a new random shift modulo one (Cranley-Patterson rotation)
+ */
+
+void nextHaltonPoint(HaltonSequence *sequence, double *point);
+/*
+ * Write next point of the sequence to point array of size dimension, every coordinate is in [0, 1)
+ */
+
+#endif //C_MATH_QUASIRANDOMGENERATOR_H
@@ -1,14 +1,20 @@
 #include "randomGenerator.h"
 
-#include <stdlib.h>
+#include <math.h>
 #include <time.h>
 
+// default stream of zeroToOneUniformRandom, floatUniformRandom and integerUniformRandom functions,
+// it starts from a fixed seed like rand() until seed or seedUniformRandom is called
+static Xoshiro256State defaultStream = {{0x9BE36BBEE7E9A2C1ull, 0x2F2B4E13B0C3A8D5ull,
+                                         0xB2E0A4C1E5F7D913ull, 0x6C8E9CF570932BD5ull}};
+
 double zeroToOneUniformRandom(void) {
     /*
-     * Generate a random number between 0 and 1
+     * Generate a random number in [0, 1) from the default stream, with 53 bits of randomness
      */
+
     // generate
-    return rand() / (double) RAND_MAX;
+    return zeroToOneXoshiro256(&defaultStream);
 } // end of zeroToOneUniformRandom
 
 double floatUniformRandom(double a, double b) {
@@ -33,16 +39,351 @@ long int integerUniformRandom(long int n) {
         return 0;
     }
 
-    // generate
-    long int guard = (long) (zeroToOneUniformRandom() * n) + 1;
-    return (guard > n) ? n : guard;
+    // generate, numbers of the last incomplete range of size n are rejected, so all integers are equally likely
+    const uint64_t range = (uint64_t) n, limit = UINT64_MAX - UINT64_MAX % range;
+    uint64_t random;
+    do {
+        random = nextXoshiro256(&defaultStream);
+    } while (random >= limit);
+
+    return (long int) (random % range) + 1;
 } // end of integerUniformRandom
 
 void seed(void) {
     /*
-     * Reset the random number generator with the system clock
+     * Reset the default stream with the system clock, a counter is mixed with the clock
+     * so calls in the same second give different streams
+     */
+
+    static uint64_t calls = 0;
+    calls++;
+    seedXoshiro256(&defaultStream, (uint64_t) time(NULL) ^ (uint64_t) clock() << 32 ^ calls * 0xD1B54A32D192ED03ull);
+} // end of seed
+
+void seedUniformRandom(uint64_t seed) {
+    /*
+     * Reset the default stream with a seed, same seed always gives same sequence of numbers
+     */
+
+    seedXoshiro256(&defaultStream, seed);
+} // end of seedUniformRandom
+
+static uint64_t splitMix64(uint64_t *x) {
+    /*
+     * Next output of a splitmix64 generator, it expands a 64 bit seed to more words
+     */
+
+    uint64_t z = (*x += 0x9E3779B97F4A7C15ull);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+} // end of splitMix64
+
+static uint64_t rotateLeft(uint64_t x, int k) {
+    return (x << k) | (x >> (64 - k));
+} // end of rotateLeft
+
+void seedXoshiro256(Xoshiro256State *state, uint64_t seed) {
+    /*
+     * Initialize the state of a xoshiro256** generator, the four words of state
+     * are the outputs of a splitmix64 generator started from the seed
+     */
+
+    for (int i = 0; i < 4; ++i) {
+        state->s[i] = splitMix64(&seed);
+    } // end of for loop
+} // end of seedXoshiro256
+
+uint64_t nextXoshiro256(Xoshiro256State *state) {
+    /*
+     * Generate next 64 bit random number of a xoshiro256** generator (Blackman and Vigna)
+     */
+
+    uint64_t *s = state->s;
+    const uint64_t result = rotateLeft(s[1] * 5, 7) * 9;
+    const uint64_t t = s[1] << 17;
+
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = rotateLeft(s[3], 45);
+
+    return result;
+} // end of nextXoshiro256
+
+double zeroToOneXoshiro256(Xoshiro256State *state) {
+    /*
+     * Generate a random number in [0, 1), upper 53 bits of a 64 bit number fill the mantissa of a double
+     */
+
+    return (double) (nextXoshiro256(state) >> 11) * 0x1.0p-53;
+} // end of zeroToOneXoshiro256
+
+static void jumpPolynomialXoshiro256(Xoshiro256State *state, const uint64_t *polynomial) {
+    /*
+     * The state after a jump is a sum of the next 256 states selected by bits of the jump polynomial
+     */
+
+    uint64_t s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+
+    for (int i = 0; i < 4; ++i) {
+        for (int b = 0; b < 64; ++b) {
+            if (polynomial[i] & (uint64_t) 1 << b) {
+                s0 ^= state->s[0];
+                s1 ^= state->s[1];
+                s2 ^= state->s[2];
+                s3 ^= state->s[3];
+            }
+            nextXoshiro256(state);
+        } // end of for loop
+    } // end of for loop
+
+    state->s[0] = s0;
+    state->s[1] = s1;
+    state->s[2] = s2;
+    state->s[3] = s3;
+} // end of jumpPolynomialXoshiro256
+
+void jumpXoshiro256(Xoshiro256State *state) {
+    /*
+     * Advance the generator 2^128 steps, it is equivalent to 2^128 calls to nextXoshiro256
+     */
+
+    static const uint64_t jump[] = {0x180EC6D33CFD0ABAull, 0xD5A61266F0C9392Cull,
+                                    0xA9582618E03FC9AAull, 0x39ABDC4529B1661Cull};
+
+    jumpPolynomialXoshiro256(state, jump);
+} // end of jumpXoshiro256
+
+void longJumpXoshiro256(Xoshiro256State *state) {
+    /*
+     * Advance the generator 2^192 steps, it is equivalent to 2^192 calls to nextXoshiro256
+     */
+
+    static const uint64_t longJump[] = {0x76E15D3EFEFDCBBFull, 0xC5004E441C522FB3ull,
+                                        0x77710069854EE241ull, 0x39109BB02ACBE635ull};
+
+    jumpPolynomialXoshiro256(state, longJump);
+} // end of longJumpXoshiro256
+
+static void multiply128(uint64_t aHigh, uint64_t aLow, uint64_t bHigh, uint64_t bLow, uint64_t *high, uint64_t *low) {
+    /*
+     * Lower 128 bits of product of two 128 bit numbers, the 64 bit product aLow * bLow
+     * is calculated with 32 bit halves so no compiler extension is needed
+     */
+
+    const uint64_t a0 = aLow & 0xFFFFFFFFull, a1 = aLow >> 32, b0 = bLow & 0xFFFFFFFFull, b1 = bLow >> 32;
+    const uint64_t p00 = a0 * b0, p01 = a0 * b1, p10 = a1 * b0, p11 = a1 * b1;
+    const uint64_t middle = (p00 >> 32) + (p01 & 0xFFFFFFFFull) + (p10 & 0xFFFFFFFFull);
+
+    *low = (middle << 32) | (p00 & 0xFFFFFFFFull);
+    *high = p11 + (p01 >> 32) + (p10 >> 32) + (middle >> 32) + aHigh * bLow + aLow * bHigh;
+} // end of multiply128
+
+static void add128(uint64_t *high, uint64_t *low, uint64_t bHigh, uint64_t bLow) {
+    *low += bLow;
+    *high += bHigh + (*low < bLow);
+} // end of add128
+
+// multiplier of the 128 bit linear congruential generator of PCG64
+#define PCG64_MULTIPLIER_HIGH 0x2360ED051FC65DA4ull
+#define PCG64_MULTIPLIER_LOW 0x4385DF649FCCF645ull
+
+static void stepPcg64(Pcg64State *state) {
+    multiply128(state->high, state->low, PCG64_MULTIPLIER_HIGH, PCG64_MULTIPLIER_LOW, &state->high, &state->low);
+    add128(&state->high, &state->low, state->incrementHigh, state->incrementLow);
+} // end of stepPcg64
+
+void seedPcg64(Pcg64State *state, uint64_t seed, uint64_t stream) {
+    /*
+     * Initialize the state of a PCG64 generator, the 128 bit initial state and stream are
+     * expanded from seed and stream with splitmix64, the increment of generator must be odd
+     */
+
+    const uint64_t seedHigh = splitMix64(&seed), seedLow = splitMix64(&seed);
+    const uint64_t streamHigh = splitMix64(&stream), streamLow = splitMix64(&stream);
+
+    state->high = 0;
+    state->low = 0;
+    state->incrementHigh = streamHigh << 1 | streamLow >> 63;
+    state->incrementLow = streamLow << 1 | 1;
+
+    stepPcg64(state);
+    add128(&state->high, &state->low, seedHigh, seedLow);
+    stepPcg64(state);
+} // end of seedPcg64
+
+uint64_t nextPcg64(Pcg64State *state) {
+    /*
+     * Generate next 64 bit random number of a PCG64 generator (O'Neill), the 128 bit state
+     * advances by a linear congruential step and it's two halves are mixed by xor and a random rotation
+     */
+
+    stepPcg64(state);
+
+    const uint64_t value = state->high ^ state->low;
+    const unsigned int rotation = (unsigned int) (state->high >> 58);
+    return (value >> rotation) | (value << ((64 - rotation) & 63));
+} // end of nextPcg64
+
+double zeroToOnePcg64(Pcg64State *state) {
+    /*
+     * Generate a random number in [0, 1), upper 53 bits of a 64 bit number fill the mantissa of a double
+     */
+
+    return (double) (nextPcg64(state) >> 11) * 0x1.0p-53;
+} // end of zeroToOnePcg64
+
+static void advancePcg64(Pcg64State *state, uint64_t deltaHigh, uint64_t deltaLow) {
+    /*
+     * Advance the generator delta steps in log(delta) time, the composition of delta steps x -> m * x + c
+     * is x -> M * x + C and M, C are built by squaring the step (Brown's algorithm)
+     */
+
+    uint64_t multiplyHigh = 0, multiplyLow = 1, plusHigh = 0, plusLow = 0;
+    uint64_t currentMultiplyHigh = PCG64_MULTIPLIER_HIGH, currentMultiplyLow = PCG64_MULTIPLIER_LOW;
+    uint64_t currentPlusHigh = state->incrementHigh, currentPlusLow = state->incrementLow, high, low;
+
+    for (int bit = 0; bit < 128; ++bit) {
+        if ((bit < 64 ? deltaLow >> bit : deltaHigh >> (bit - 64)) & 1) {
+            multiply128(multiplyHigh, multiplyLow, currentMultiplyHigh, currentMultiplyLow, &multiplyHigh,
+                        &multiplyLow);
+            multiply128(plusHigh, plusLow, currentMultiplyHigh, currentMultiplyLow, &plusHigh, &plusLow);
+            add128(&plusHigh, &plusLow, currentPlusHigh, currentPlusLow);
+        } // end of if
+
+        // c <- (m + 1) * c, m <- m * m
+        high = currentMultiplyHigh;
+        low = currentMultiplyLow;
+        add128(&high, &low, 0, 1);
+        multiply128(high, low, currentPlusHigh, currentPlusLow, &currentPlusHigh, &currentPlusLow);
+        multiply128(currentMultiplyHigh, currentMultiplyLow, currentMultiplyHigh, currentMultiplyLow,
+                    &currentMultiplyHigh, &currentMultiplyLow);
+    } // end of for loop
+
+    multiply128(multiplyHigh, multiplyLow, state->high, state->low, &state->high, &state->low);
+    add128(&state->high, &state->low, plusHigh, plusLow);
+} // end of advancePcg64
+
+void jumpPcg64(Pcg64State *state) {
+    /*
+     * Advance the generator 2^64 steps, it is equivalent to 2^64 calls to nextPcg64
+     */
+
+    advancePcg64(state, 1, 0);
+} // end of jumpPcg64
+
+void longJumpPcg64(Pcg64State *state) {
+    /*
+     * Advance the generator 2^96 steps, it is equivalent to 2^96 calls to nextPcg64
      */
 
-    time_t t;
-    srand((unsigned) time(&t));
-} // end of seed
\ No newline at end of file
+    advancePcg64(state, (uint64_t) 1 << 32, 0);
+} // end of longJumpPcg64
+
+void seedXoshiro256Lanes(Xoshiro256LanesState *lanes, const Xoshiro256State *state) {
+    /*
+     * Initialize the lanes of bulk generator, lane k is the state after k long jumps
+     */
+
+    Xoshiro256State lane = *state;
+
+    for (int k = 0; k < RANDOM_LANES; ++k) {
+        for (int i = 0; i < 4; ++i) {
+            lanes->s[i][k] = lane.s[i];
+        } // end of for loop
+        longJumpXoshiro256(&lane);
+    } // end of for loop
+} // end of seedXoshiro256Lanes
+
+void fillUniform(Xoshiro256LanesState *lanes, double *out, size_t n, double a, double b) {
+    /*
+     * Fill out with uniform random numbers in [a, b), every step makes RANDOM_LANES numbers, one from every lane.
+     * the loop over lanes has no dependency between iterations, multiplications by 5 and 9 are shifts and additions
+     * and the double is made from bits, upper 52 bits of number are the mantissa of a double in [1, 2) and the 53rd
+     * bit adds 2^-53, so it's exactly (number >> 11) * 2^-53 and all of it is vectorized by compiler.
+     */
+
+    const double width = b - a;
+    uint64_t *restrict s0 = lanes->s[0], *restrict s1 = lanes->s[1], *restrict s2 = lanes->s[2],
+            *restrict s3 = lanes->s[3];
+    double last[RANDOM_LANES];
+
+    for (size_t i = 0; i < n; i += RANDOM_LANES) {
+        // the last incomplete group is written to a temporary group
+        double *restrict group = i + RANDOM_LANES <= n ? out + i : last;
+
+        for (int k = 0; k < RANDOM_LANES; ++k) {
+            const uint64_t x = s1[k] + (s1[k] << 2);
+            const uint64_t rotated = (x << 7) | (x >> 57);
+            const uint64_t result = rotated + (rotated << 3);
+            uint64_t w0 = s0[k], w1 = s1[k], w2 = s2[k], w3 = s3[k];
+            union {
+                uint64_t bits;
+                double value;
+            } high, low;
+
+            w2 ^= w0;
+            w3 ^= w1;
+            w1 ^= w2;
+            w0 ^= w3;
+            w2 ^= s1[k] << 17;
+            w3 = (w3 << 45) | (w3 >> 19);
+            s0[k] = w0;
+            s1[k] = w1;
+            s2[k] = w2;
+            s3[k] = w3;
+
+            // 0x3FF0000000000000 is 1 and 0x3CA0000000000000 is 2^-53
+            high.bits = (result >> 12) | 0x3FF0000000000000ull;
+            low.bits = (0 - ((result >> 11) & 1)) & 0x3CA0000000000000ull;
+            group[k] = a + width * ((high.value - 1) + low.value);
+        } // end of for loop
+
+        if (group == last) {
+            for (size_t k = 0; i + k < n; ++k) {
+                out[i + k] = last[k];
+            } // end of for loop
+        } // end of if
+    } // end of for loop
+} // end of fillUniform
+
+void fillNormal(Xoshiro256LanesState *lanes, double *out, size_t n, double mean, double deviation) {
+    /*
+     * Fill out with normal random numbers, every pair of uniform numbers u1, u2 gives two independent normal
+     * numbers r * cos(2 * pi * u2) and r * sin(2 * pi * u2) with r = sqrt(-2 * ln(1 - u1)) (Box-Muller transform)
+     */
+
+    const double twoPi = 2 * 3.14159265358979323846;
+    double pair[2];
+    size_t i = 0;
+
+    fillUniform(lanes, out, n, 0, 1);
+
+    for (; i + 2 <= n; i += 2) {
+        const double r = deviation * sqrt(-2 * log(1 - out[i])), angle = twoPi * out[i + 1];
+
+        out[i] = mean + r * cos(angle);
+        out[i + 1] = mean + r * sin(angle);
+    } // end of for loop
+
+    // an odd number needs one more pair
+    if (i < n) {
+        fillUniform(lanes, pair, 2, 0, 1);
+        out[i] = mean + deviation * sqrt(-2 * log(1 - pair[0])) * cos(twoPi * pair[1]);
+    } // end of if
+} // end of fillNormal
+
+void fillExponential(Xoshiro256LanesState *lanes, double *out, size_t n, double rate) {
+    /*
+     * Fill out with exponential random numbers, -ln(1 - u) / rate is exponential if u is uniform in [0, 1)
+     */
+
+    fillUniform(lanes, out, n, 0, 1);
+
+    for (size_t i = 0; i < n; ++i) {
+        out[i] = -log(1 - out[i]) / rate;
+    } // end of for loop
+} // end of fillExponential
@@ -1,12 +1,129 @@
 #ifndef C_MATH_RANDOMGENERATOR_H
 #define C_MATH_RANDOMGENERATOR_H
 
+#include <stdint.h>
+#include <stddef.h>
+
+// number of independent xoshiro256** generators which bulk functions run side by side,
+// their states are stored word by word so the compiler can keep all lanes in SIMD registers
+#define RANDOM_LANES 16
+
+typedef struct {
+    uint64_t s[4];
+} Xoshiro256State;
+
+typedef struct {
+    uint64_t s[4][RANDOM_LANES];    // s[i][k] is word i of state of lane k
+} Xoshiro256LanesState;
+
+typedef struct {
+    uint64_t high, low;                     // 128 bit state
+    uint64_t incrementHigh, incrementLow;   // 128 bit odd increment, it selects the stream
+} Pcg64State;
+
 double zeroToOneUniformRandom(void);
+/*
+ * Generate a random number in [0, 1) with 53 bits of randomness from the default stream,
+ * the default stream is a xoshiro256** generator shared by all callers, so it's not thread safe,
+ * parallel code must use it's own Xoshiro256State or Pcg64State for every thread
+ */
 
 double floatUniformRandom(double a, double b);
+/*
+ * Generate a random number in [a, b) from the default stream
+ */
 
 long int integerUniformRandom(long int n);
+/*
+ * Generate a random integer between 1 and |n| from the default stream, all of them are equally likely
+ */
 
 void seed(void);
+/*
+ * Reset the default stream with the system clock
+ */
+
+void seedUniformRandom(uint64_t seed);
+/*
+ * Reset the default stream with a seed, same seed always gives same sequence of numbers
+ */
+
+void seedXoshiro256(Xoshiro256State *state, uint64_t seed);
+/*
+ * Initialize the state of a xoshiro256** generator from a 64 bit seed (expanded with splitmix64),
+ * same seed always gives same sequence of numbers
+ */
+
+uint64_t nextXoshiro256(Xoshiro256State *state);
+/*
+ * Generate next 64 bit random number of a xoshiro256** generator
+ */
+
+double zeroToOneXoshiro256(Xoshiro256State *state);
+/*
+ * Generate a random number in [0, 1) with 53 bits of randomness
+ */
+
+void jumpXoshiro256(Xoshiro256State *state);
+/*
+ * Advance the generator 2^128 steps, calling it k times on a copy of a state gives the k-th
+ * independent stream of that seed, which does not overlap other streams
+ */
+
+void longJumpXoshiro256(Xoshiro256State *state);
+/*
+ * Advance the generator 2^192 steps, long jumps make 2^64 starting points for groups of streams,
+ * every group can be split by jumpXoshiro256 again, like a stream for every thread of every process
+ */
+
+void seedPcg64(Pcg64State *state, uint64_t seed, uint64_t stream);
+/*
+ * Initialize the state of a PCG64 generator from a 64 bit seed and a stream number,
+ * generators with different streams give different sequences even with the same seed
+ */
+
+uint64_t nextPcg64(Pcg64State *state);
+/*
+ * Generate next 64 bit random number of a PCG64 generator (128 bit LCG with XSL RR output)
+ */
+
+double zeroToOnePcg64(Pcg64State *state);
+/*
+ * Generate a random number in [0, 1) with 53 bits of randomness
+ */
+
+void jumpPcg64(Pcg64State *state);
+/*
+ * Advance the generator 2^64 steps in 128 steps of work, calling it k times on a copy of a state
+ * gives the k-th independent stream of that seed
+ */
+
+void longJumpPcg64(Pcg64State *state);
+/*
+ * Advance the generator 2^96 steps, it makes 2^32 groups of 2^32 streams made by jumpPcg64
+ */
+
+void seedXoshiro256Lanes(Xoshiro256LanesState *lanes, const Xoshiro256State *state);
+/*
+ * Initialize the lanes of bulk generator from a xoshiro256** state, lane k is the state after k long jumps,
+ * so lanes of states which are made by jumpXoshiro256 from a seed never overlap each other
+ */
+
+void fillUniform(Xoshiro256LanesState *lanes, double *out, size_t n, double a, double b);
+/*
+ * Fill out[0 .. n - 1] with random numbers in [a, b) with 53 bits of randomness,
+ * lanes generate RANDOM_LANES numbers together, so it's many times faster than a call for every number
+ */
+
+void fillNormal(Xoshiro256LanesState *lanes, double *out, size_t n, double mean, double deviation);
+/*
+ * Fill out[0 .. n - 1] with normal random numbers by Box-Muller transform of uniform numbers
+ */
+
+void fillExponential(Xoshiro256LanesState *lanes, double *out, size_t n, double rate);
+/*
+ * Fill out[0 .. n - 1] with exponential random numbers with the given rate (mean is 1 / rate)
+ * by inversion of uniform numbers
+ */
 
 #endif //C_MATH_RANDOMGENERATOR_H
@@ -52,13 +52,13 @@ void main() {
     } //end of interval check
 
     TYPE:
-    printf("Select type of false position algorithm {Original: 0 , Illinois: 1 , Anderson-Bjork: 2}:\n");
+    printf("Select type of false position algorithm {Original: 0 , Illinois: 1 , Anderson-Bjork: 2 , Pegasus: 3}:\n");
     fgets(algorithmType_c, sizeof(algorithmType_c), stdin);
     algorithmType = strtol(algorithmType_c, &ptr, 10);
 
     // check algorithmType value
-    if (algorithmType != 0 && algorithmType != 1 && algorithmType != 2) {
-        printf("Error: invalid type. you must enter either 0 or 1 or 2.\n");
+    if (algorithmType < 0 || algorithmType > 3) {
+        printf("Error: invalid type. you must enter either 0 or 1 or 2 or 3.\n");
 
         // a chance to correct your mistake :)
         printf("\nDo you want to try again? {0: no, 1: yes}\n");
@@ -0,0 +1,70 @@
+#include "../Assets/Function Root Finder Algorithms/falsePositionAlgorithm.h"
+#include "../Assets/Util/functions.h"
+#include "../Assets/Util/util.h"
+#include "../Assets/Util/_configurations.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define TEST_FUNCTIONS 10
+#define METHODS 4
+
+void main() {
+    /*
+     * Benchmark of false position method and it's improvements, this program solves standard test functions
+     * with every option of falsePosition and shows number of function evaluations which each method needs
+     * to reach |f(x)| < 1e-12.
+     */
+
+    // standard test functions and their brackets
+    const char *expressions[TEST_FUNCTIONS] = {"x^3-2*x-5", "cos(x)-x", "x*exp(x)-1", "exp(x)-2", "x^10-1",
+                                               "x^3", "atan(x)", "exp(-x)-x^3", "sin(x)-x/2", "(x-1)^5"};
+    const double a[TEST_FUNCTIONS] = {2, 0, 0, 0, 0, -1, -1, 0, 1, 0};
+    const double b[TEST_FUNCTIONS] = {3, 1, 1, 2, 1.3, 2, 10, 1, 3, 3};
+    const char *methods[METHODS] = {"Original", "Illinois", "Anderson-Bjork", "Pegasus"};
+
+    // initializing variables
+    char expression[INPUT_SIZE];
+    unsigned int evaluations, total[METHODS] = {0};
+    int state;
+
+    printf("\t\t\t\tRoot Finder\n"
+           "\t\t\t  False Position Benchmark\n\n");
+
+    printf("%-14s", "f(x)");
+    for (int j = 0; j < METHODS; ++j) {
+        printf("%16s", methods[j]);
+    } // end of for loop
+    printf("\n");
+
+    for (int i = 0; i < TEST_FUNCTIONS; ++i) {
+        CompiledFunction function;
+        strcpy(expression, expressions[i]);
+        compileFunction_n_arg(&function, expression, 1);
+
+        printf("%-14s", expressions[i]);
+        for (int j = 0; j < METHODS; ++j) {
+            state = 1;
+            falsePositionCompiled(&function, a[i], b[i], 0, 0, 1e-12, 10000, j, 0, &state, &evaluations);
+            total[j] += evaluations;
+
+            if (state) {
+                printf("%16u", evaluations);
+            } else { // if no answer
+                printf("%15u*", evaluations);
+            } // end of if
+        } // end of for loop
+        printf("\n");
+
+        freeCompiledFunction(&function);
+    } // end of for loop
+
+    printf("%-14s", "total");
+    for (int j = 0; j < METHODS; ++j) {
+        printf("%16u", total[j]);
+    } // end of for loop
+    printf("\n\n* didn't converge in 10000 iterations.\n");
+
+    Exit(EXIT_SUCCESS);
+} // end of main
@@ -0,0 +1,197 @@
+#include "../Assets/Function Root Finder Algorithms/fixedPointAlgorithm.h"
+#include "../Assets/Util/util.h"
+#include "../Assets/Util/_configurations.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+void main() {
+    /*
+     * Interface of program, this interface will get necessary information from user.
+     */
+
+    // initializing variables
+    char expression[INPUT_SIZE];
+    char x0_c[INPUT_SIZE], transform_c[INPUT_SIZE], options_c[INPUT_SIZE], ete_c[INPUT_SIZE], ere_c[INPUT_SIZE],
+            tol_c[INPUT_SIZE], maxiter_c[INPUT_SIZE], verbose_c[INPUT_SIZE], tryAgain_c[INPUT_SIZE];
+    char *ptr;
+    int transform = 0, options = 0, maxiter = 0, verbose = 0, tryAgain = 0, flag = 1;
+    double x0, ete, ere, tol;
+
+    printf("\t\t\t\tRoot Finder\n"
+           "\t\t\t  Fixed Point Iteration\n");
+
+    START: //LABEL for goto
+    // getting required data from user
+    TRANSFORM: //LABEL for goto
+    printf("\nSelect type of equation {0: x = g(x), 1: f(x) = 0}:\n");
+    fgets(transform_c, sizeof(transform_c), stdin);
+    transform = strtol(transform_c, &ptr, 10);
+
+    // check transform value
+    if (transform != 0 && transform != 1) {
+        printf("Error: invalid type. you must enter either 0 or 1.\n");
+
+        // a chance to correct your mistake :)
+        printf("\nDo you want to try again? {0: no, 1: yes}\n");
+        fgets(tryAgain_c, sizeof(tryAgain_c), stdin);
+        tryAgain = strtol(tryAgain_c, &ptr, 10);
+        if (tryAgain) {
+            goto TRANSFORM;
+        } else {
+            Exit(EXIT_FAILURE);
+        } // end of if goto
+    } // end of if transform
+
+    if (transform) {
+        printf("Enter f(x) (example: x^2-3):\n");
+    } else {
+        printf("Enter g(x) (example: cos(x)):\n");
+    } // end of if
+    fgets(expression, sizeof(expression), stdin);
+
+    OPTIONS: //LABEL for goto
+    printf("Select type of acceleration {None: 0 , Aitken: 1 , Steffensen: 2}:\n");
+    fgets(options_c, sizeof(options_c), stdin);
+    options = strtol(options_c, &ptr, 10);
+
+    // check options value
+    if (options < 0 || options > 2) {
+        printf("Error: invalid type. you must enter either 0 or 1 or 2.\n");
+
+        // a chance to correct your mistake :)
+        printf("\nDo you want to try again? {0: no, 1: yes}\n");
+        fgets(tryAgain_c, sizeof(tryAgain_c), stdin);
+        tryAgain = strtol(tryAgain_c, &ptr, 10);
+        if (tryAgain) {
+            goto OPTIONS;
+        } else {
+            Exit(EXIT_FAILURE);
+        } // end of if goto
+    } // end of if options
+
+    printf("Enter the starting point (x0):\n");
+    fgets(x0_c, sizeof(x0_c), stdin);
+    x0 = strtod(x0_c, &ptr);
+
+    ETE: //LABEL for goto
+    printf("Enter the estimated true error limit: (enter 0 if you don't want to set an ETE limit):\n");
+    fgets(ete_c, sizeof(ete_c), stdin);
+    ete = strtod(ete_c, &ptr);
+
+    // check ete to be positive
+    if (ete < 0) {
+        printf("Error: estimated true error limit must be a \"POSITIVE\" number!\n");
+
+        // a chance to correct your mistake :)
+        printf("\nDo you want to try again? {0: no, 1: yes}\n");
+        fgets(tryAgain_c, sizeof(tryAgain_c), stdin);
+        tryAgain = strtol(tryAgain_c, &ptr, 10);
+        if (tryAgain) {
+            goto ETE;
+        } else {
+            Exit(EXIT_FAILURE);
+        } // end of if goto
+    } // end of ete check
+
+    ERE: //LABEL for goto
+    printf("Enter the estimated relative error limit (enter 0 if you don't want to set an ERE limit):\n");
+    fgets(ere_c, sizeof(ere_c), stdin);
+    ere = strtod(ere_c, &ptr);
+
+    // check ere to be positive
+    if (ere < 0) {
+        printf("Error: estimated relative error limit must be a \"POSITIVE\" number!\n");
+
+        // a chance to correct your mistake :)
+        printf("\nDo you want to try again? {0: no, 1: yes}\n");
+        fgets(tryAgain_c, sizeof(tryAgain_c), stdin);
+        tryAgain = strtol(tryAgain_c, &ptr, 10);
+        if (tryAgain) {
+            goto ERE;
+        } else {
+            Exit(EXIT_FAILURE);
+        } // end of if goto
+    } // end of ere check
+
+    TOL: //LABEL for goto
+    printf("Enter the tolerance limit (enter 0 if you don't want to set a tolerance limit):\n");
+    fgets(tol_c, sizeof(tol_c), stdin);
+    tol = strtod(tol_c, &ptr);
+
+    // check tol to be positive
+    if (tol < 0) {
+        printf("Error: estimated tolerance limit must be a \"POSITIVE\" number!\n");
+
+        // a chance to correct your mistake :)
+        printf("\nDo you want to try again? {0: no, 1: yes}\n");
+        fgets(tryAgain_c, sizeof(tryAgain_c), stdin);
+        tryAgain = strtol(tryAgain_c, &ptr, 10);
+        if (tryAgain) {
+            goto TOL;
+        } else {
+            Exit(EXIT_FAILURE);
+        } // end of if goto
+    } // end of ere check
+
+    MAXITER: //LABEL for goto
+    printf("Enter the maximum iteration limit (must be positive number):\n");
+    fgets(maxiter_c, sizeof(maxiter_c), stdin);
+    maxiter = strtol(maxiter_c, &ptr, 10);
+
+    // check maximum iteration to be more than 0
+    if (maxiter <= 0) {
+        printf("Error: invalid value for maximum iteration limit!\n");
+
+        // a chance to correct your mistake :)
+        printf("\nDo you want to try again? {0: no, 1: yes}\n");
+        fgets(tryAgain_c, sizeof(tryAgain_c), stdin);
+        tryAgain = strtol(tryAgain_c, &ptr, 10);
+        if (tryAgain) {
+            goto MAXITER;
+        } else {
+            Exit(EXIT_FAILURE);
+        } // end of if goto
+    }// end of if maxiter
+
+    VERBOSE: //LABEL for goto
+    printf("Do you want to see steps? {0: no, 1: yes}:\n");
+    fgets(verbose_c, sizeof(verbose_c), stdin);
+    verbose = strtol(verbose_c, &ptr, 10);
+
+    // check verbose value
+    if (verbose != 0 && verbose != 1) {
+        printf("Error: invalid value for verbose!\n");
+
+        // a chance to correct your mistake :)
+        printf("\nDo you want to try again? {0: no, 1: yes}\n");
+        fgets(tryAgain_c, sizeof(tryAgain_c), stdin);
+        tryAgain = strtol(tryAgain_c, &ptr, 10);
+        if (tryAgain) {
+            goto VERBOSE;
+        } else {
+            Exit(EXIT_FAILURE);
+        } // end of if goto
+    } // end of if verbose
+
+    // calculation
+    double x = fixedPoint(expression, x0, transform, options, ete, ere, tol, (unsigned int) maxiter, verbose, &flag);
+
+    // if there was an answer
+    if (flag) {
+        printf("\nThis method solved the equation %sfor x= %lf .\n\n", expression, x);
+    } else { // if no answer
+        printf("\nThis method couldn't find the root of equation %s"
+               "the last calculated value for x is: %lf .\n\n", expression, x);
+    } // end of if flag
+
+    // do you want to start again??
+    printf("\nDo you want to start again? {0: no, 1: yes}\n");
+    fgets(tryAgain_c, sizeof(tryAgain_c), stdin);
+    tryAgain = strtol(tryAgain_c, &ptr, 10);
+    if (tryAgain) {
+        goto START;
+    } else {
+        Exit(EXIT_SUCCESS);
+    } // end of if goto
+} // end of main
@@ -0,0 +1,177 @@
+#include "../Assets/Function Root Finder Algorithms/householderAlgorithm.h"
+#include "../Assets/Util/util.h"
+#include "../Assets/Util/_configurations.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+void main() {
+    /*
+     * Interface of program, this interface will get necessary information from user.
+     */
+
+    // initializing variables
+    char expression[INPUT_SIZE];
+    char x0_c[INPUT_SIZE], order_c[INPUT_SIZE], ete_c[INPUT_SIZE], ere_c[INPUT_SIZE],
+            tol_c[INPUT_SIZE], maxiter_c[INPUT_SIZE], verbose_c[INPUT_SIZE], tryAgain_c[INPUT_SIZE];
+    char *ptr;
+    int order = 0, maxiter = 0, verbose = 0, tryAgain = 0, flag = 1;
+    unsigned int iterations = 0, evaluations = 0;
+    double x0, ete, ere, tol;
+
+    printf("\t\t\t\tRoot Finder\n"
+           "\t\t\t   Householder Methods\n");
+
+    START: //LABEL for goto
+    // getting required data from user
+    printf("\nEnter the equation you want to solve (example: x^2-3):\n");
+    fgets(expression, sizeof(expression), stdin);
+
+    printf("Enter the starting point (x0):\n");
+    fgets(x0_c, sizeof(x0_c), stdin);
+    x0 = strtod(x0_c, &ptr);
+
+    ORDER: //LABEL for goto
+    printf("Choose order of method {1: Newton, 2: Halley, 3: third order Householder}:\n");
+    fgets(order_c, sizeof(order_c), stdin);
+    order = strtol(order_c, &ptr, 10);
+
+    // check order value
+    if (order < 1 || order > 3) {
+        printf("Error: invalid value for order!\n");
+
+        // a chance to correct your mistake :)
+        printf("\nDo you want to try again? {0: no, 1: yes}\n");
+        fgets(tryAgain_c, sizeof(tryAgain_c), stdin);
+        tryAgain = strtol(tryAgain_c, &ptr, 10);
+        if (tryAgain) {
+            goto ORDER;
+        } else {
+            Exit(EXIT_FAILURE);
+        } // end of if goto
+    } // end of if order
+
+    ETE: //LABEL for goto
+    printf("Enter the estimated true error limit: (enter 0 if you don't want to set an ETE limit):\n");
+    fgets(ete_c, sizeof(ete_c), stdin);
+    ete = strtod(ete_c, &ptr);
+
+    // check ete to be positive
+    if (ete < 0) {
+        printf("Error: estimated true error limit must be a \"POSITIVE\" number!\n");
+
+        // a chance to correct your mistake :)
+        printf("\nDo you want to try again? {0: no, 1: yes}\n");
+        fgets(tryAgain_c, sizeof(tryAgain_c), stdin);
+        tryAgain = strtol(tryAgain_c, &ptr, 10);
+        if (tryAgain) {
+            goto ETE;
+        } else {
+            Exit(EXIT_FAILURE);
+        } // end of if goto
+    } // end of ete check
+
+    ERE: //LABEL for goto
+    printf("Enter the estimated relative error limit (enter 0 if you don't want to set an ERE limit):\n");
+    fgets(ere_c, sizeof(ere_c), stdin);
+    ere = strtod(ere_c, &ptr);
+
+    // check ere to be positive
+    if (ere < 0) {
+        printf("Error: estimated relative error limit must be a \"POSITIVE\" number!\n");
+
+        // a chance to correct your mistake :)
+        printf("\nDo you want to try again? {0: no, 1: yes}\n");
+        fgets(tryAgain_c, sizeof(tryAgain_c), stdin);
+        tryAgain = strtol(tryAgain_c, &ptr, 10);
+        if (tryAgain) {
+            goto ERE;
+        } else {
+            Exit(EXIT_FAILURE);
+        } // end of if goto
+    } // end of ere check
+
+    TOL: //LABEL for goto
+    printf("Enter the tolerance limit (enter 0 if you don't want to set a tolerance limit):\n");
+    fgets(tol_c, sizeof(tol_c), stdin);
+    tol = strtod(tol_c, &ptr);
+
+    // check tol to be positive
+    if (tol < 0) {
+        printf("Error: estimated tolerance limit must be a \"POSITIVE\" number!\n");
+
+        // a chance to correct your mistake :)
+        printf("\nDo you want to try again? {0: no, 1: yes}\n");
+        fgets(tryAgain_c, sizeof(tryAgain_c), stdin);
+        tryAgain = strtol(tryAgain_c, &ptr, 10);
+        if (tryAgain) {
+            goto TOL;
+        } else {
+            Exit(EXIT_FAILURE);
+        } // end of if goto
+    } // end of ere check
+
+    MAXITER: //LABEL for goto
+    printf("Enter the maximum iteration limit (must be positive number):\n");
+    fgets(maxiter_c, sizeof(maxiter_c), stdin);
+    maxiter = strtol(maxiter_c, &ptr, 10);
+
+    // check maximum iteration to be more than 0
+    if (maxiter <= 0) {
+        printf("Error: invalid value for maximum iteration limit!\n");
+
+        // a chance to correct your mistake :)
+        printf("\nDo you want to try again? {0: no, 1: yes}\n");
+        fgets(tryAgain_c, sizeof(tryAgain_c), stdin);
+        tryAgain = strtol(tryAgain_c, &ptr, 10);
+        if (tryAgain) {
+            goto MAXITER;
+        } else {
+            Exit(EXIT_FAILURE);
+        } // end of if goto
+    }// end of if maxiter
+
+    VERBOSE: //LABEL for goto
+    printf("Do you want to see steps? {0: no, 1: yes}:\n");
+    fgets(verbose_c, sizeof(verbose_c), stdin);
+    verbose = strtol(verbose_c, &ptr, 10);
+
+    // check verbose value
+    if (verbose != 0 && verbose != 1) {
+        printf("Error: invalid value for verbose!\n");
+
+        // a chance to correct your mistake :)
+        printf("\nDo you want to try again? {0: no, 1: yes}\n");
+        fgets(tryAgain_c, sizeof(tryAgain_c), stdin);
+        tryAgain = strtol(tryAgain_c, &ptr, 10);
+        if (tryAgain) {
+            goto VERBOSE;
+        } else {
+            Exit(EXIT_FAILURE);
+        } // end of if goto
+    } // end of if verbose
+
+    // calculation
+    double x = householder(expression, x0, (unsigned int) order, ete, ere, tol, (unsigned int) maxiter, verbose,
+                           &flag, &iterations, &evaluations);
+
+    // if there was an answer
+    if (flag) {
+        printf("\nThis method solved the equation %sfor x= %lf .\n\n", expression, x);
+    } else { // if no answer
+        printf("\nThis method couldn't find the root of equation %s"
+               "the last calculated value for x is: %lf .\n\n", expression, x);
+    } // end of if flag
+
+    printf("Number of iterations: %u, number of function evaluations: %u\n", iterations, evaluations);
+
+    // do you want to start again??
+    printf("\nDo you want to start again? {0: no, 1: yes}\n");
+    fgets(tryAgain_c, sizeof(tryAgain_c), stdin);
+    tryAgain = strtol(tryAgain_c, &ptr, 10);
+    if (tryAgain) {
+        goto START;
+    } else {
+        Exit(EXIT_SUCCESS);
+    } // end of if goto
+} // end of main
@@ -0,0 +1,140 @@
+#include "../Assets/Function Root Finder Algorithms/polynomialRootsAlgorithm.h"
+#include "../Assets/Util/util.h"
+#include "../Assets/Util/_configurations.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+void main() {
+    /*
+     * Interface of program, this interface will get necessary information from user.
+     */
+
+    // initializing variables
+    char expression[INPUT_SIZE];
+    char ete_c[INPUT_SIZE], ere_c[INPUT_SIZE], maxiter_c[INPUT_SIZE], verbose_c[INPUT_SIZE], tryAgain_c[INPUT_SIZE];
+    char *ptr;
+    int maxiter = 0, verbose = 0, tryAgain = 0, flag = 1;
+    double ete, ere;
+    double realParts[POLYNOMIAL_MAX_DEGREE], imaginaryParts[POLYNOMIAL_MAX_DEGREE];
+
+    printf("\t\t\t\tRoot Finder\n"
+           "\t\t\t  Polynomial Roots (Aberth Method)\n");
+
+    START: //LABEL for goto
+    // getting required data from user
+    printf("\nEnter the polynomial you want to solve (example: x^3-2*x-5):\n");
+    fgets(expression, sizeof(expression), stdin);
+
+    ETE: //LABEL for goto
+    printf("Enter the estimated true error limit: (enter 0 if you don't want to set an ETE limit):\n");
+    fgets(ete_c, sizeof(ete_c), stdin);
+    ete = strtod(ete_c, &ptr);
+
+    // check ete to be positive
+    if (ete < 0) {
+        printf("Error: estimated true error limit must be a \"POSITIVE\" number!\n");
+
+        // a chance to correct your mistake :)
+        printf("\nDo you want to try again? {0: no, 1: yes}\n");
+        fgets(tryAgain_c, sizeof(tryAgain_c), stdin);
+        tryAgain = strtol(tryAgain_c, &ptr, 10);
+        if (tryAgain) {
+            goto ETE;
+        } else {
+            Exit(EXIT_FAILURE);
+        } // end of if goto
+    } // end of ete check
+
+    ERE: //LABEL for goto
+    printf("Enter the estimated relative error limit (enter 0 if you don't want to set an ERE limit):\n");
+    fgets(ere_c, sizeof(ere_c), stdin);
+    ere = strtod(ere_c, &ptr);
+
+    // check ere to be positive
+    if (ere < 0) {
+        printf("Error: estimated relative error limit must be a \"POSITIVE\" number!\n");
+
+        // a chance to correct your mistake :)
+        printf("\nDo you want to try again? {0: no, 1: yes}\n");
+        fgets(tryAgain_c, sizeof(tryAgain_c), stdin);
+        tryAgain = strtol(tryAgain_c, &ptr, 10);
+        if (tryAgain) {
+            goto ERE;
+        } else {
+            Exit(EXIT_FAILURE);
+        } // end of if goto
+    } // end of ere check
+
+    MAXITER: //LABEL for goto
+    printf("Enter the maximum iteration limit (must be positive number):\n");
+    fgets(maxiter_c, sizeof(maxiter_c), stdin);
+    maxiter = strtol(maxiter_c, &ptr, 10);
+
+    // check maximum iteration to be more than 0
+    if (maxiter <= 0) {
+        printf("Error: invalid value for maximum iteration limit!\n");
+
+        // a chance to correct your mistake :)
+        printf("\nDo you want to try again? {0: no, 1: yes}\n");
+        fgets(tryAgain_c, sizeof(tryAgain_c), stdin);
+        tryAgain = strtol(tryAgain_c, &ptr, 10);
+        if (tryAgain) {
+            goto MAXITER;
+        } else {
+            Exit(EXIT_FAILURE);
+        } // end of if goto
+    }// end of if maxiter
+
+    VERBOSE: //LABEL for goto
+    printf("Do you want to see steps? {0: no, 1: yes}:\n");
+    fgets(verbose_c, sizeof(verbose_c), stdin);
+    verbose = strtol(verbose_c, &ptr, 10);
+
+    // check verbose value
+    if (verbose != 0 && verbose != 1) {
+        printf("Error: invalid value for verbose!\n");
+
+        // a chance to correct your mistake :)
+        printf("\nDo you want to try again? {0: no, 1: yes}\n");
+        fgets(tryAgain_c, sizeof(tryAgain_c), stdin);
+        tryAgain = strtol(tryAgain_c, &ptr, 10);
+        if (tryAgain) {
+            goto VERBOSE;
+        } else {
+            Exit(EXIT_FAILURE);
+        } // end of if goto
+    } // end of if verbose
+
+    // calculation
+    unsigned int count = polynomialRoots(expression, POLYNOMIAL_MAX_DEGREE, ete, ere, (unsigned int) maxiter,
+                                         realParts, imaginaryParts, verbose, &flag);
+
+    // if there was an answer
+    if (flag) {
+        printf("\nThis method solved the equation %sfor all of it's %u roots:\n", expression, count);
+    } else { // if no answer
+        printf("\nThis method couldn't find the roots of equation %s"
+               "it must be a polynomial of degree at most %d, the last calculated values are:\n",
+               expression, POLYNOMIAL_MAX_DEGREE);
+    } // end of if flag
+
+    for (unsigned int i = 0; i < count; ++i) {
+        if (imaginaryParts[i] == 0) {
+            printf("x%u = %lf\n", i + 1, realParts[i]);
+        } else {
+            printf("x%u = %lf %c %lfi\n", i + 1, realParts[i], imaginaryParts[i] < 0 ? '-' : '+',
+                   imaginaryParts[i] < 0 ? -imaginaryParts[i] : imaginaryParts[i]);
+        } // end of if
+    } // end of for loop
+
+    // do you want to start again??
+    printf("\nDo you want to start again? {0: no, 1: yes}\n");
+    fgets(tryAgain_c, sizeof(tryAgain_c), stdin);
+    tryAgain = strtol(tryAgain_c, &ptr, 10);
+    if (tryAgain) {
+        goto START;
+    } else {
+        Exit(EXIT_SUCCESS);
+    } // end of if goto
+} // end of main
@@ -52,13 +52,16 @@ void main() {
 
     TYPE: //LABEL for goto
     // get type of monte carlo integration
-    printf("Select type of Monte Carlo integration {Random points: 0 , Random rectangles: 1}:\n");
+    printf("Select type of Monte Carlo integration {Random points: 0 , Random rectangles: 1 ,"
+           " Quasi random rectangles: 2 ,"
+           " Stratified rectangles: 3 , Antithetic rectangles: 4 ,"
+           " Random points with adaptive rectangle: 5}:\n");
     fgets(options_c, sizeof(options_c), stdin);
     options = strtol(options_c, &ptr, 10);
 
     // check options value
-    if (options != 0 && options != 1) {
-        printf("Error: Wrong type number! you have to enter either 0 or 1 .\n");
+    if (options < 0 || options > 5) {
+        printf("Error: Wrong type number! you have to enter a number between 0 and 5 .\n");
 
         // a chance to correct your mistake :)
         printf("\nDo you want to try again? {0: no, 1: yes}\n");
@@ -75,25 +78,39 @@ void main() {
     // get number of points or rectangles
     switch (options){
         case 0:
+        case 5:
             printf("Enter the number of random points for integration:\n");
             break;
         case 1:
             printf("Enter the number of random rectangles for integration:\n");
             break;
+        case 2:
+            printf("Enter the number of quasi random rectangles for integration:\n");
+            break;
+        case 3:
+        case 4:
+            printf("Enter the number of random rectangles for integration (at least 4):\n");
+            break;
     } // end of switch
     // get number from user
     fgets(n_c, sizeof(n_c), stdin);
     n = strtol(n_c, &ptr, 10);
 
     // check n to be more than zero
-    if (n <= 0) {
+    if (n <= 0 || ((options == 3 || options == 4) && n < 4)) {
         switch (options) {
             case 0:
+            case 5:
                 printf("Error: number of points must be more than zero!\n");
                 break;
             case 1:
+            case 2:
                 printf("Error: number of rectangles must be more than zero!\n");
                 break;
+            case 3:
+            case 4:
+                printf("Error: number of rectangles must be at least 4!\n");
+                break;
         } // end of switch
 
         // a chance to correct your mistake :)
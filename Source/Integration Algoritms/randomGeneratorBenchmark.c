@@ -0,0 +1,102 @@
+#include "../Assets/Util/randomGenerator.h"
+#include "../Assets/Util/util.h"
+#include "../Assets/Util/_configurations.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define SAMPLES 100000000
+#define BUFFER_SIZE 65536
+#define METHODS 7
+
+void main() {
+    /*
+     * Benchmark of random number generators, this program generates 10^8 numbers with every generator,
+     * the old rand() path, calls for every number and bulk fill functions, and shows time, speed and mean
+     * of numbers (0.5 for uniform, 0 for normal and 1 for exponential numbers) as a check of generators.
+     */
+
+    const char *methods[METHODS] = {"rand() / RAND_MAX", "zeroToOneUniformRandom", "zeroToOneXoshiro256",
+                                    "zeroToOnePcg64", "fillUniform", "fillNormal", "fillExponential"};
+
+    // initializing variables
+    double *buffer = (double *) malloc(BUFFER_SIZE * sizeof(double));
+    double sum;
+    clock_t start, ticks;
+    Xoshiro256State xoshiro;
+    Xoshiro256LanesState lanes;
+    Pcg64State pcg;
+
+    if (buffer == NULL) {
+        printf("Unable to allocate memory!\n");
+        Exit(EXIT_FAILURE);
+    } // end of if
+
+    srand(1);
+    seedUniformRandom(1);
+    seedXoshiro256(&xoshiro, 1);
+    seedXoshiro256Lanes(&lanes, &xoshiro);
+    seedPcg64(&pcg, 1, 0);
+
+    printf("\t\t\t\tRandom Generator\n"
+           "\t\t\t\t   Benchmark\n\n");
+
+    printf("%-24s%16s%20s%16s\n", "method", "time (ms)", "numbers (M/s)", "mean");
+
+    for (int j = 0; j < METHODS; ++j) {
+        sum = 0;
+        ticks = 0;
+
+        // numbers are generated in a buffer which stays in cache, so speed of memory doesn't matter
+        for (long int done = 0; done < SAMPLES; done += BUFFER_SIZE) {
+            start = clock();
+            switch (j) {
+                case 0:
+                    for (int i = 0; i < BUFFER_SIZE; ++i) {
+                        buffer[i] = rand() / (double) RAND_MAX;
+                    } // end of for loop
+                    break;
+                case 1:
+                    for (int i = 0; i < BUFFER_SIZE; ++i) {
+                        buffer[i] = zeroToOneUniformRandom();
+                    } // end of for loop
+                    break;
+                case 2:
+                    for (int i = 0; i < BUFFER_SIZE; ++i) {
+                        buffer[i] = zeroToOneXoshiro256(&xoshiro);
+                    } // end of for loop
+                    break;
+                case 3:
+                    for (int i = 0; i < BUFFER_SIZE; ++i) {
+                        buffer[i] = zeroToOnePcg64(&pcg);
+                    } // end of for loop
+                    break;
+                case 4:
+                    fillUniform(&lanes, buffer, BUFFER_SIZE, 0, 1);
+                    break;
+                case 5:
+                    fillNormal(&lanes, buffer, BUFFER_SIZE, 0, 1);
+                    break;
+                default:
+                    fillExponential(&lanes, buffer, BUFFER_SIZE, 1);
+            } // end of switch
+            ticks += clock() - start;
+
+            // mean is calculated out of timing
+            for (int i = 0; i < BUFFER_SIZE; ++i) {
+                sum += buffer[i];
+            } // end of for loop
+        } // end of for loop
+
+        const double seconds = (double) ticks / CLOCKS_PER_SEC;
+        const double count = (double) ((SAMPLES + BUFFER_SIZE - 1) / BUFFER_SIZE * BUFFER_SIZE);
+        printf("%-24s%16.1lf%20.1lf%16.5lf\n", methods[j], 1000 * seconds, count / seconds / 1e6, sum / count);
+    } // end of for loop
+
+    printf("\nbulk functions use %d lanes, build with -march=native to let compiler use wider SIMD registers.\n",
+           RANDOM_LANES);
+
+    free(buffer);
+    Exit(EXIT_SUCCESS);
+} // end of main
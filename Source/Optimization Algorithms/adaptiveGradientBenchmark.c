@@ -0,0 +1,62 @@
+#include "../Assets/Optimization Algorithms/adaptiveGradientAlgorithm.h"
+#include "../Assets/Util/util.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#define TEST_FUNCTIONS 7
+#define POLICIES 5
+#define MAXITER 100000
+
+int main() {
+    /*
+     * Benchmark of step policies of gradient descent, this program minimizes ill-scaled test functions with
+     * the same learning rate and shows number of iterations which each policy needs to reach |x1 - x0| < 1e-8.
+     */
+
+    // ill-scaled test functions, all of them have their minimum at x = 1 except the last one
+    const char *expressions[TEST_FUNCTIONS] = {"(x-1)^2", "1e-3*(x-1)^2", "900*(x-1)^2", "(x-1)^4",
+                                               "exp(x-1)-x", "1e-2*cosh(10*(x-1))", "x^2/2+x^4/4-x"};
+    const double x0[TEST_FUNCTIONS] = {5, 5, 5, 3, 5, 2, 5};
+    const char *policies[POLICIES] = {"Fixed", "Line Search", "Momentum", "Nesterov", "Adam"};
+    const double gamma = 1e-2;
+
+    // initializing variables
+    unsigned int iterations, total[POLICIES] = {0};
+    int state;
+
+    printf("\t\t\t\tOptimization\n"
+           "\t\t\t  Gradient Descent Step Policies Benchmark\n\n");
+
+    printf("%-22s", "f(x)");
+    for (int j = 0; j < POLICIES; ++j) {
+        printf("%14s", policies[j]);
+    } // end of for loop
+    printf("\n");
+
+    for (int i = 0; i < TEST_FUNCTIONS; ++i) {
+        printf("%-22s", expressions[i]);
+
+        for (int j = 0; j < POLICIES; ++j) {
+            state = 1;
+            adaptiveGradientDescent(expressions[i], x0[i], 1e-8, 0, gamma, j, MAXITER, 0, &state, &iterations);
+            total[j] += iterations;
+
+            if (state) {
+                printf("%14u", iterations);
+            } else { // if no answer
+                printf("%13u*", iterations);
+            } // end of if
+        } // end of for loop
+        printf("\n");
+    } // end of for loop
+
+    printf("%-22s", "total");
+    for (int j = 0; j < POLICIES; ++j) {
+        printf("%14u", total[j]);
+    } // end of for loop
+    printf("\n\nlearning rate is %g for all policies.\n"
+           "* didn't converge in %d iterations or diverged.\n", gamma, MAXITER);
+
+    Exit(EXIT_SUCCESS);
+} // end of main
@@ -0,0 +1,229 @@
+#include "../Assets/Optimization Algorithms/goldenSectionSearchAlgorithm.h"
+#include "../Assets/Optimization Algorithms/brentMinimizerAlgorithm.h"
+#include "../Assets/Optimization Algorithms/branchAndBoundAlgorithm.h"
+#include "../Assets/Util/util.h"
+#include "../Assets/Util/_configurations.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+void main() {
+    /*
+     * Interface of program, this interface will get necessary information from user.
+     */
+
+    // initializing variables
+    char expression[INPUT_SIZE], negated[INPUT_SIZE + 4];
+    char a[INPUT_SIZE], b[INPUT_SIZE], ete_c[INPUT_SIZE], ere_c[INPUT_SIZE], method_c[INPUT_SIZE],
+            maximize_c[INPUT_SIZE], maxiter_c[INPUT_SIZE], verbose_c[INPUT_SIZE], tryAgain_c[INPUT_SIZE];
+    char *ptr;
+    int method = 0, maximize = 0, maxiter = 0, verbose = 0, tryAgain = 0, flag = 1;
+    double a0, b0, ete, ere, result, value, bound;
+
+    printf("\t\t\t\tOptimization Algorithm\n"
+           "\t\t\t    Bounded One Dimensional Search\n");
+
+    START: //LABEL for goto
+    // getting required data from user
+    printf("\nEnter the function you want to optimize (example: x^4-3*x^3+2):\n");
+    fgets(expression, sizeof(expression), stdin);
+
+    METHOD: //LABEL for goto
+    printf("Select the method {Golden-Section Search: 0 , Brent: 1 , Branch and Bound (certified global): 2}:\n");
+    fgets(method_c, sizeof(method_c), stdin);
+    method = strtol(method_c, &ptr, 10);
+
+    // check method value
+    if (method != 0 && method != 1 && method != 2) {
+        printf("Error: wrong method number! you have to enter either 0, 1 or 2\n");
+
+        // a chance to correct your mistake :)
+        printf("\nDo you want to try again? {0: no, 1: yes}\n");
+        fgets(tryAgain_c, sizeof(tryAgain_c), stdin);
+        tryAgain = strtol(tryAgain_c, &ptr, 10);
+        if (tryAgain) {
+            goto METHOD;
+        } else {
+            Exit(EXIT_FAILURE);
+        } // end of if goto
+    } // end of if method
+
+    MAXIMIZE: //LABEL for goto
+    printf("Select the extremum {minimum: 0 , maximum: 1}:\n");
+    fgets(maximize_c, sizeof(maximize_c), stdin);
+    maximize = strtol(maximize_c, &ptr, 10);
+
+    // check maximize value
+    if (maximize != 0 && maximize != 1) {
+        printf("Error: wrong extremum number! you have to enter either 0 or 1\n");
+
+        // a chance to correct your mistake :)
+        printf("\nDo you want to try again? {0: no, 1: yes}\n");
+        fgets(tryAgain_c, sizeof(tryAgain_c), stdin);
+        tryAgain = strtol(tryAgain_c, &ptr, 10);
+        if (tryAgain) {
+            goto MAXIMIZE;
+        } else {
+            Exit(EXIT_FAILURE);
+        } // end of if goto
+    } // end of if maximize
+
+    INTERVAL: //LABEL for goto
+    printf("Choose an interval [a, b]:\n");
+    printf("Enter a:\n");
+    fgets(a, sizeof(a), stdin);
+    a0 = strtod(a, &ptr);
+    printf("Enter b:\n");
+    fgets(b, sizeof(b), stdin);
+    b0 = strtod(b, &ptr);
+
+    // check interval
+    if (a0 == b0) {
+        printf("Error: improper interval! 'a' and 'b' can't have same valueS.\n");
+
+        // a chance to correct your mistake :)
+        printf("\nDo you want to try again? {0: no, 1: yes}\n");
+        fgets(tryAgain_c, sizeof(tryAgain_c), stdin);
+        tryAgain = strtol(tryAgain_c, &ptr, 10);
+        if (tryAgain) {
+            goto INTERVAL;
+        } else {
+            Exit(EXIT_FAILURE);
+        } // end of if goto
+    } //end of interval check
+
+    ETE: //LABEL for goto
+    printf("Enter the estimated true error limit: (enter 0 if you don't want to set an ETE limit):\n");
+    fgets(ete_c, sizeof(ete_c), stdin);
+    ete = strtod(ete_c, &ptr);
+
+    // check ete to be positive
+    if (ete < 0) {
+        printf("Error: estimated true error limit must be a \"POSITIVE\" number!\n");
+
+        // a chance to correct your mistake :)
+        printf("\nDo you want to try again? {0: no, 1: yes}\n");
+        fgets(tryAgain_c, sizeof(tryAgain_c), stdin);
+        tryAgain = strtol(tryAgain_c, &ptr, 10);
+        if (tryAgain) {
+            goto ETE;
+        } else {
+            Exit(EXIT_FAILURE);
+        } // end of if goto
+    } // end of ete check
+
+    ERE: //LABEL for goto
+    if (method == 2) {
+        // branch and bound compares the tolerance with the gap of incumbent and lower bound of global extremum
+        printf("Enter the tolerance limit of extremum value (enter 0 if you don't want to set a tolerance limit):\n");
+    } else {
+        printf("Enter the estimated relative error limit (enter 0 if you don't want to set an ERE limit):\n");
+    } // end of if
+    fgets(ere_c, sizeof(ere_c), stdin);
+    ere = strtod(ere_c, &ptr);
+
+    // check ere to be positive
+    if (ere < 0) {
+        printf("Error: estimated relative error limit must be a \"POSITIVE\" number!\n");
+
+        // a chance to correct your mistake :)
+        printf("\nDo you want to try again? {0: no, 1: yes}\n");
+        fgets(tryAgain_c, sizeof(tryAgain_c), stdin);
+        tryAgain = strtol(tryAgain_c, &ptr, 10);
+        if (tryAgain) {
+            goto ERE;
+        } else {
+            Exit(EXIT_FAILURE);
+        } // end of if goto
+    } // end of ere check
+
+    MAXITER: //LABEL for goto
+    if (method == 2) {
+        printf("Enter the maximum number of cells (must be more than 1, 1000000 is usual):\n");
+    } else {
+        printf("Enter the maximum iteration limit (must be positive number):\n");
+    } // end of if
+    fgets(maxiter_c, sizeof(maxiter_c), stdin);
+    maxiter = strtol(maxiter_c, &ptr, 10);
+
+    // check maximum iteration to be more than 0
+    if (maxiter <= 0 || (method == 2 && maxiter < 2)) {
+        printf("Error: invalid value for maximum iteration limit!\n");
+
+        // a chance to correct your mistake :)
+        printf("\nDo you want to try again? {0: no, 1: yes}\n");
+        fgets(tryAgain_c, sizeof(tryAgain_c), stdin);
+        tryAgain = strtol(tryAgain_c, &ptr, 10);
+        if (tryAgain) {
+            goto MAXITER;
+        } else {
+            Exit(EXIT_FAILURE);
+        } // end of if goto
+    }// end of if maxiter
+
+    VERBOSE: //LABEL for goto
+    printf("Do you want to see steps? {0: no, 1: yes}:\n");
+    fgets(verbose_c, sizeof(verbose_c), stdin);
+    verbose = strtol(verbose_c, &ptr, 10);
+
+    // check verbose value
+    if (verbose != 0 && verbose != 1) {
+        printf("Error: invalid value for verbose!\n");
+
+        // a chance to correct your mistake :)
+        printf("\nDo you want to try again? {0: no, 1: yes}\n");
+        fgets(tryAgain_c, sizeof(tryAgain_c), stdin);
+        tryAgain = strtol(tryAgain_c, &ptr, 10);
+        if (tryAgain) {
+            goto VERBOSE;
+        } else {
+            Exit(EXIT_FAILURE);
+        } // end of if goto
+    } // end of if verbose
+
+    // calculate with respect of selected method
+    if (method == 2) {
+        if (ete == 0 && ere == 0) {
+            printf("\nError: branch and bound needs at least one of ETE and tolerance limits!\n");
+            goto ETE;
+        } // end of if
+
+        // maximum of f is minimum of -f
+        if (maximize) {
+            strcpy(negated, "-(");
+            strncat(negated, expression, INPUT_SIZE);
+            strcat(negated, ")");
+        } // end of if
+
+        value = branchAndBound(maximize ? negated : expression, a0 < b0 ? a0 : b0, a0 < b0 ? b0 : a0, ete, ere,
+                           (unsigned long int) maxiter, verbose, &result, &bound, &flag);
+        printf("\nThe %s value found is %lf, and the global extremum is %s %lf .\n",
+               maximize ? "maximum" : "minimum", maximize ? -value : value, maximize ? "at most" : "at least",
+               maximize ? -bound : bound);
+    } else if (method) {
+        result = brentMinimizer(expression, a0, b0, ete, ere, (unsigned int) maxiter, maximize, verbose, &flag);
+    } else {
+        result = goldenSectionSearch(expression, a0, b0, ete, ere, (unsigned int) maxiter, maximize, verbose, &flag);
+    } // end of if
+
+    // if there was an answer
+    if (flag) {
+        printf("\nThis method has found the %s of the function %sat point x = %lf .\n\n",
+               maximize ? "maximum" : "minimum", expression, result);
+    } else { // if no answer
+        printf("\nThis method didn't find the %s of the function %s"
+               "the last calculated value for x is: %lf .\n\n", maximize ? "maximum" : "minimum", expression, result);
+    } // end of if flag
+
+    // do you want to start again??
+    printf("\nDo you want to start again? {0: no, 1: yes}\n");
+    fgets(tryAgain_c, sizeof(tryAgain_c), stdin);
+    tryAgain = strtol(tryAgain_c, &ptr, 10);
+    if (tryAgain) {
+        goto START;
+    } else {
+        Exit(EXIT_SUCCESS);
+    } // end of if goto
+} // end of main
+
@@ -0,0 +1,299 @@
+#include "../Assets/Optimization Algorithms/differentialEvolutionAlgorithm.h"
+#include "../Assets/Optimization Algorithms/simulatedAnnealingAlgorithm.h"
+#include "../Assets/Util/util.h"
+#include "../Assets/Util/_configurations.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+int main() {
+    /*
+     * Interface of program, this interface will get necessary information from user.
+     */
+
+    // initializing variables
+    char expression[4 * INPUT_SIZE];
+    char method_c[INPUT_SIZE], dimension_c[INPUT_SIZE], value_c[INPUT_SIZE], size_c[INPUT_SIZE],
+            reheats_c[INPUT_SIZE], budget_c[INPUT_SIZE], seed_c[INPUT_SIZE], ete_c[INPUT_SIZE], ere_c[INPUT_SIZE],
+            tol_c[INPUT_SIZE], verbose_c[INPUT_SIZE], tryAgain_c[INPUT_SIZE];
+    char *ptr;
+    int method = 0, dimension = 0, size = 0, reheats = 0, verbose = 0, tryAgain = 0, flag = 1;
+    long int budget = 0;
+    unsigned long long int seed = 0;
+    double ete, ere, tol, result;
+    double *x = NULL, *lower = NULL, *upper = NULL;
+
+    printf("\t\t\t\tOptimization Algorithm\n"
+           "\t\t\t\t   Global Optimizer\n");
+
+    START: //LABEL for goto
+    flag = 1;
+
+    METHOD: //LABEL for goto
+    // getting required data from user
+    printf("\nEnter the method {0: differential evolution, 1: simulated annealing}:\n");
+    fgets(method_c, sizeof(method_c), stdin);
+    method = strtol(method_c, &ptr, 10);
+
+    // check method value
+    if (method != 0 && method != 1) {
+        printf("Error: invalid value for method!\n");
+
+        // a chance to correct your mistake :)
+        printf("\nDo you want to try again? {0: no, 1: yes}\n");
+        fgets(tryAgain_c, sizeof(tryAgain_c), stdin);
+        tryAgain = strtol(tryAgain_c, &ptr, 10);
+        if (tryAgain) {
+            goto METHOD;
+        } else {
+            Exit(EXIT_FAILURE);
+        } // end of if goto
+    } // end of if method
+
+    DIMENSION: //LABEL for goto
+    printf("Enter number of arguments of the function:\n");
+    fgets(dimension_c, sizeof(dimension_c), stdin);
+    dimension = strtol(dimension_c, &ptr, 10);
+
+    // check dimension to be more than 0
+    if (dimension <= 0) {
+        printf("Error: number of arguments must be more than zero!\n");
+
+        // a chance to correct your mistake :)
+        printf("\nDo you want to try again? {0: no, 1: yes}\n");
+        fgets(tryAgain_c, sizeof(tryAgain_c), stdin);
+        tryAgain = strtol(tryAgain_c, &ptr, 10);
+        if (tryAgain) {
+            goto DIMENSION;
+        } else {
+            Exit(EXIT_FAILURE);
+        } // end of if goto
+    } // end of if dimension
+
+    printf("Enter the function you want to minimize with arguments x1, x2, ... "
+           "(example: sin(10*x1)*x1^2+x2^2):\n");
+    fgets(expression, sizeof(expression), stdin);
+
+    free(x);
+    free(lower);
+    free(upper);
+    x = (double *) malloc(dimension * sizeof(double));
+    lower = (double *) malloc(dimension * sizeof(double));
+    upper = (double *) malloc(dimension * sizeof(double));
+
+    if (x == NULL || lower == NULL || upper == NULL) {
+        printf("Unable to allocate memory!\n");
+        Exit(EXIT_FAILURE);
+    } // end of if
+
+    for (int i = 0; i < dimension; ++i) {
+        LOWER: //LABEL for goto
+        printf("Enter lower bound of x%d:\n", i + 1);
+        fgets(value_c, sizeof(value_c), stdin);
+        lower[i] = strtod(value_c, &ptr);
+        printf("Enter upper bound of x%d:\n", i + 1);
+        fgets(value_c, sizeof(value_c), stdin);
+        upper[i] = strtod(value_c, &ptr);
+
+        // check bounds
+        if (!(lower[i] <= upper[i])) {
+            printf("Error: lower bound can't be more than upper bound!\n");
+
+            // a chance to correct your mistake :)
+            printf("\nDo you want to try again? {0: no, 1: yes}\n");
+            fgets(tryAgain_c, sizeof(tryAgain_c), stdin);
+            tryAgain = strtol(tryAgain_c, &ptr, 10);
+            if (tryAgain) {
+                goto LOWER;
+            } else {
+                Exit(EXIT_FAILURE);
+            } // end of if goto
+        } // end of bounds check
+    } // end of for loop
+
+    SIZE: //LABEL for goto
+    if (method == 0) {
+        printf("Enter the population (at least 4, 10 times number of arguments is usual):\n");
+    } else {
+        printf("Enter number of chains (must be a positive number):\n");
+    } // end of if
+    fgets(size_c, sizeof(size_c), stdin);
+    size = strtol(size_c, &ptr, 10);
+
+    // check size of population
+    if (size < (method == 0 ? 4 : 1)) {
+        printf("Error: invalid value for size of population!\n");
+
+        // a chance to correct your mistake :)
+        printf("\nDo you want to try again? {0: no, 1: yes}\n");
+        fgets(tryAgain_c, sizeof(tryAgain_c), stdin);
+        tryAgain = strtol(tryAgain_c, &ptr, 10);
+        if (tryAgain) {
+            goto SIZE;
+        } else {
+            Exit(EXIT_FAILURE);
+        } // end of if goto
+    } // end of if size
+
+    if (method == 1) {
+        REHEATS: //LABEL for goto
+        printf("Enter maximum number of reheatings:\n");
+        fgets(reheats_c, sizeof(reheats_c), stdin);
+        reheats = strtol(reheats_c, &ptr, 10);
+
+        // check reheats to be positive
+        if (reheats < 0) {
+            printf("Error: number of reheatings can't be negative!\n");
+
+            // a chance to correct your mistake :)
+            printf("\nDo you want to try again? {0: no, 1: yes}\n");
+            fgets(tryAgain_c, sizeof(tryAgain_c), stdin);
+            tryAgain = strtol(tryAgain_c, &ptr, 10);
+            if (tryAgain) {
+                goto REHEATS;
+            } else {
+                Exit(EXIT_FAILURE);
+            } // end of if goto
+        } // end of if reheats
+    } // end of if method
+
+    ETE: //LABEL for goto
+    printf("Enter the estimated true error limit: (enter 0 if you don't want to set an ETE limit):\n");
+    fgets(ete_c, sizeof(ete_c), stdin);
+    ete = strtod(ete_c, &ptr);
+
+    // check ete to be positive
+    if (ete < 0) {
+        printf("Error: estimated true error limit must be a \"POSITIVE\" number!\n");
+
+        // a chance to correct your mistake :)
+        printf("\nDo you want to try again? {0: no, 1: yes}\n");
+        fgets(tryAgain_c, sizeof(tryAgain_c), stdin);
+        tryAgain = strtol(tryAgain_c, &ptr, 10);
+        if (tryAgain) {
+            goto ETE;
+        } else {
+            Exit(EXIT_FAILURE);
+        } // end of if goto
+    } // end of ete check
+
+    ERE: //LABEL for goto
+    printf("Enter the estimated relative error limit (enter 0 if you don't want to set an ERE limit):\n");
+    fgets(ere_c, sizeof(ere_c), stdin);
+    ere = strtod(ere_c, &ptr);
+
+    // check ere to be positive
+    if (ere < 0) {
+        printf("Error: estimated relative error limit must be a \"POSITIVE\" number!\n");
+
+        // a chance to correct your mistake :)
+        printf("\nDo you want to try again? {0: no, 1: yes}\n");
+        fgets(tryAgain_c, sizeof(tryAgain_c), stdin);
+        tryAgain = strtol(tryAgain_c, &ptr, 10);
+        if (tryAgain) {
+            goto ERE;
+        } else {
+            Exit(EXIT_FAILURE);
+        } // end of if goto
+    } // end of ere check
+
+    TOL: //LABEL for goto
+    printf("Enter the tolerance limit of function (enter 0 if you don't want to set a tolerance limit):\n");
+    fgets(tol_c, sizeof(tol_c), stdin);
+    tol = strtod(tol_c, &ptr);
+
+    // check tol to be positive
+    if (tol < 0) {
+        printf("Error: tolerance limit must be a \"POSITIVE\" number!\n");
+
+        // a chance to correct your mistake :)
+        printf("\nDo you want to try again? {0: no, 1: yes}\n");
+        fgets(tryAgain_c, sizeof(tryAgain_c), stdin);
+        tryAgain = strtol(tryAgain_c, &ptr, 10);
+        if (tryAgain) {
+            goto TOL;
+        } else {
+            Exit(EXIT_FAILURE);
+        } // end of if goto
+    } // end of tol check
+
+    BUDGET: //LABEL for goto
+    printf("Enter the maximum number of function evaluations (must be at least the size of population):\n");
+    fgets(budget_c, sizeof(budget_c), stdin);
+    budget = strtol(budget_c, &ptr, 10);
+
+    // check budget to be enough for population
+    if (budget < size) {
+        printf("Error: invalid value for maximum number of function evaluations!\n");
+
+        // a chance to correct your mistake :)
+        printf("\nDo you want to try again? {0: no, 1: yes}\n");
+        fgets(tryAgain_c, sizeof(tryAgain_c), stdin);
+        tryAgain = strtol(tryAgain_c, &ptr, 10);
+        if (tryAgain) {
+            goto BUDGET;
+        } else {
+            Exit(EXIT_FAILURE);
+        } // end of if goto
+    } // end of if budget
+
+    printf("Enter the seed of random generator (the same seed gives the same answer):\n");
+    fgets(seed_c, sizeof(seed_c), stdin);
+    seed = strtoull(seed_c, &ptr, 10);
+
+    VERBOSE: //LABEL for goto
+    printf("Do you want to see steps? {0: no, 1: yes}:\n");
+    fgets(verbose_c, sizeof(verbose_c), stdin);
+    verbose = strtol(verbose_c, &ptr, 10);
+
+    // check verbose value
+    if (verbose != 0 && verbose != 1) {
+        printf("Error: invalid value for verbose!\n");
+
+        // a chance to correct your mistake :)
+        printf("\nDo you want to try again? {0: no, 1: yes}\n");
+        fgets(tryAgain_c, sizeof(tryAgain_c), stdin);
+        tryAgain = strtol(tryAgain_c, &ptr, 10);
+        if (tryAgain) {
+            goto VERBOSE;
+        } else {
+            Exit(EXIT_FAILURE);
+        } // end of if goto
+    } // end of if verbose
+
+    // calculation, differential evolution with dithered weight and crossover 0.9,
+    // simulated annealing with the initial temperature estimated from the function
+    if (method == 0) {
+        result = differentialEvolution(expression, (unsigned int) dimension, lower, upper, (unsigned int) size, 0, 0.9,
+                                       ete, ere, tol, (unsigned long int) budget, seed, x, verbose, &flag);
+    } else {
+        result = simulatedAnnealing(expression, (unsigned int) dimension, lower, upper, (unsigned int) size, 0,
+                                    (unsigned int) reheats, ete, ere, tol, (unsigned long int) budget, seed, x,
+                                    verbose, &flag);
+    } // end of if method
+
+    // if there was an answer
+    if (flag) {
+        printf("\nThis method has found the minimum of the function %swith value %lf at point:\n", expression, result);
+    } else { // if no answer
+        printf("\nThis method didn't converge for the function %s"
+               "the best calculated value is %lf at point:\n", expression, result);
+    } // end of if flag
+
+    for (int i = 0; i < dimension; ++i) {
+        printf("x%d = %lf\n", i + 1, x[i]);
+    } // end of for loop
+
+    // do you want to start again??
+    printf("\nDo you want to start again? {0: no, 1: yes}\n");
+    fgets(tryAgain_c, sizeof(tryAgain_c), stdin);
+    tryAgain = strtol(tryAgain_c, &ptr, 10);
+    if (tryAgain) {
+        goto START;
+    } else {
+        free(x);
+        free(lower);
+        free(upper);
+        Exit(EXIT_SUCCESS);
+    } // end of if goto
+} // end of main
@@ -1,4 +1,6 @@
 #include "../Assets/Optimization Algorithms/gradientDescentAlgorithm.h"
+#include "../Assets/Optimization Algorithms/adaptiveGradientAlgorithm.h"
+#include "../Assets/Optimization Algorithms/brentMinimizerAlgorithm.h"
 #include "../Assets/Util/util.h"
 #include "../Assets/Util/_configurations.h"
 
@@ -13,9 +15,9 @@ int main() {
     // initializing variables
     char expression[INPUT_SIZE];
     char a[INPUT_SIZE], b[INPUT_SIZE], x0_c[INPUT_SIZE], gamma_c[INPUT_SIZE], ete_c[INPUT_SIZE], ere_c[INPUT_SIZE],
-            maxiter_c[INPUT_SIZE], options_c[INPUT_SIZE], verbose_c[INPUT_SIZE], tryAgain_c[INPUT_SIZE];
+            maxiter_c[INPUT_SIZE], options_c[INPUT_SIZE], policy_c[INPUT_SIZE], verbose_c[INPUT_SIZE], tryAgain_c[INPUT_SIZE];
     char *ptr;
-    int maxiter = 0, options = 0, verbose = 0, tryAgain = 0, flag = 1;;
+    int maxiter = 0, options = 0, policy = 0, verbose = 0, tryAgain = 0, flag = 1;;
     double a0, b0, x0, gamma, ete, ere, result;
 
     printf("\t\t\t\tOptimization Algorithm\n"
@@ -29,7 +31,7 @@ int main() {
     TYPE: //LABEL for goto
     // get type of gradient ascent optimization
     printf("Select type of Gradient Descent Optimization {nearest extremum to x0: 0 , "
-           "over custom interval [a, b]: 1}:\n");
+           "over custom interval [a, b] with Brent's method: 1}:\n");
     fgets(options_c, sizeof(options_c), stdin);
     options = strtol(options_c, &ptr, 10);
 
@@ -82,9 +84,35 @@ int main() {
             break;
     } // end of switch
 
-    printf("Enter the step size (aka gamma or learning rate): \n");
-    fgets(gamma_c, sizeof(gamma_c), stdin);
-    gamma = strtod(gamma_c, &ptr);
+    // step size is only used by gradient steps, Brent's method doesn't need it
+    if (options == 0) {
+        printf("Enter the step size (aka gamma or learning rate): \n");
+        fgets(gamma_c, sizeof(gamma_c), stdin);
+        gamma = strtod(gamma_c, &ptr);
+    } // end of if options
+
+    POLICY: //LABEL for goto
+    // step policy is only available for nearest extremum to x0
+    if (options == 0) {
+        printf("Select the step policy {fixed: 0, backtracking line search: 1, momentum: 2, nesterov: 3, adam: 4}:\n");
+        fgets(policy_c, sizeof(policy_c), stdin);
+        policy = strtol(policy_c, &ptr, 10);
+
+        // check policy value
+        if (policy < 0 || policy > 4) {
+            printf("Error: wrong policy number! you have to enter a number from 0 to 4\n");
+
+            // a chance to correct your mistake :)
+            printf("\nDo you want to try again? {0: no, 1: yes}\n");
+            fgets(tryAgain_c, sizeof(tryAgain_c), stdin);
+            tryAgain = strtol(tryAgain_c, &ptr, 10);
+            if (tryAgain) {
+                goto POLICY;
+            } else {
+                Exit(EXIT_FAILURE);
+            } // end of if goto
+        } // end of if policy
+    } // end of if options
 
     ETE: //LABEL for goto
     printf("Enter the estimated true error limit: (enter 0 if you don't want to set an ETE limit):\n");
@@ -169,10 +197,16 @@ int main() {
     // calculate with respect of selected type
     switch (options) {
         case 0:
-            result = gradientDescent(expression, x0, ete, ere, gamma, (unsigned int) maxiter, verbose, &flag);
+            if (policy == 0) {
+                result = gradientDescent(expression, x0, ete, ere, gamma, (unsigned int) maxiter, verbose, &flag);
+            } else {
+                result = adaptiveGradientDescent(expression, x0, ete, ere, gamma, policy, (unsigned int) maxiter,
+                                                 verbose, &flag, NULL);
+            } // end of if
             break;
         case 1:
-            result = gradientDescentInterval(expression, a0, b0, ete, ere, gamma, (unsigned int) maxiter, verbose);
+            // bounded problems use Brent's method, it needs no step size and converges superlinearly
+            result = brentMinimizer(expression, a0, b0, ete, ere, (unsigned int) maxiter, 0, verbose, &flag);
             break;
     }
 
@@ -0,0 +1,254 @@
+#include "../Assets/Optimization Algorithms/nelderMeadAlgorithm.h"
+#include "../Assets/Util/util.h"
+#include "../Assets/Util/_configurations.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+int main() {
+    /*
+     * Interface of program, this interface will get necessary information from user.
+     */
+
+    // initializing variables
+    char expression[4 * INPUT_SIZE];
+    char dimension_c[INPUT_SIZE], value_c[INPUT_SIZE], size_c[INPUT_SIZE], adaptive_c[INPUT_SIZE],
+            restarts_c[INPUT_SIZE], ete_c[INPUT_SIZE], ere_c[INPUT_SIZE], tol_c[INPUT_SIZE], maxiter_c[INPUT_SIZE], verbose_c[INPUT_SIZE],
+            tryAgain_c[INPUT_SIZE];
+    char *ptr;
+    int dimension = 0, adaptive = 0, restarts = 0, maxiter = 0, verbose = 0, tryAgain = 0, flag = 1;
+    double size, ete, ere, tol, result;
+    double *x = NULL;
+
+    printf("\t\t\t\tOptimization Algorithm\n"
+           "\t\t\t\t     Nelder-Mead\n");
+
+    START: //LABEL for goto
+    flag = 1;
+
+    DIMENSION: //LABEL for goto
+    // getting required data from user
+    printf("\nEnter number of arguments of the function:\n");
+    fgets(dimension_c, sizeof(dimension_c), stdin);
+    dimension = strtol(dimension_c, &ptr, 10);
+
+    // check dimension to be more than 0
+    if (dimension <= 0) {
+        printf("Error: number of arguments must be more than zero!\n");
+
+        // a chance to correct your mistake :)
+        printf("\nDo you want to try again? {0: no, 1: yes}\n");
+        fgets(tryAgain_c, sizeof(tryAgain_c), stdin);
+        tryAgain = strtol(tryAgain_c, &ptr, 10);
+        if (tryAgain) {
+            goto DIMENSION;
+        } else {
+            Exit(EXIT_FAILURE);
+        } // end of if goto
+    } // end of if dimension
+
+    printf("Enter the function you want to minimize with arguments x1, x2, ... "
+           "(example: abs(x1-1)+(x2+2)^2):\n");
+    fgets(expression, sizeof(expression), stdin);
+
+    free(x);
+    x = (double *) malloc(dimension * sizeof(double));
+
+    if (x == NULL) {
+        printf("Unable to allocate memory!\n");
+        Exit(EXIT_FAILURE);
+    } // end of if
+
+    for (int i = 0; i < dimension; ++i) {
+        printf("Enter x%d of the starting point:\n", i + 1);
+        fgets(value_c, sizeof(value_c), stdin);
+        x[i] = strtod(value_c, &ptr);
+    } // end of for loop
+
+    SIZE: //LABEL for goto
+    printf("Enter length of edges of the initial simplex (must be a positive number):\n");
+    fgets(size_c, sizeof(size_c), stdin);
+    size = strtod(size_c, &ptr);
+
+    // check size to be more than 0
+    if (size <= 0) {
+        printf("Error: length of edges must be more than zero!\n");
+
+        // a chance to correct your mistake :)
+        printf("\nDo you want to try again? {0: no, 1: yes}\n");
+        fgets(tryAgain_c, sizeof(tryAgain_c), stdin);
+        tryAgain = strtol(tryAgain_c, &ptr, 10);
+        if (tryAgain) {
+            goto SIZE;
+        } else {
+            Exit(EXIT_FAILURE);
+        } // end of if goto
+    } // end of if size
+
+    ADAPTIVE: //LABEL for goto
+    printf("Do you want to use adaptive coefficients? {0: no, 1: yes}:\n");
+    fgets(adaptive_c, sizeof(adaptive_c), stdin);
+    adaptive = strtol(adaptive_c, &ptr, 10);
+
+    // check adaptive value
+    if (adaptive != 0 && adaptive != 1) {
+        printf("Error: invalid value for adaptive!\n");
+
+        // a chance to correct your mistake :)
+        printf("\nDo you want to try again? {0: no, 1: yes}\n");
+        fgets(tryAgain_c, sizeof(tryAgain_c), stdin);
+        tryAgain = strtol(tryAgain_c, &ptr, 10);
+        if (tryAgain) {
+            goto ADAPTIVE;
+        } else {
+            Exit(EXIT_FAILURE);
+        } // end of if goto
+    } // end of if adaptive
+
+    RESTARTS: //LABEL for goto
+    printf("Enter the maximum number of restarts:\n");
+    fgets(restarts_c, sizeof(restarts_c), stdin);
+    restarts = strtol(restarts_c, &ptr, 10);
+
+    // check restarts to be positive
+    if (restarts < 0) {
+        printf("Error: number of restarts must be a \"POSITIVE\" number!\n");
+
+        // a chance to correct your mistake :)
+        printf("\nDo you want to try again? {0: no, 1: yes}\n");
+        fgets(tryAgain_c, sizeof(tryAgain_c), stdin);
+        tryAgain = strtol(tryAgain_c, &ptr, 10);
+        if (tryAgain) {
+            goto RESTARTS;
+        } else {
+            Exit(EXIT_FAILURE);
+        } // end of if goto
+    } // end of if restarts
+
+    ETE: //LABEL for goto
+    printf("Enter the estimated true error limit: (enter 0 if you don't want to set an ETE limit):\n");
+    fgets(ete_c, sizeof(ete_c), stdin);
+    ete = strtod(ete_c, &ptr);
+
+    // check ete to be positive
+    if (ete < 0) {
+        printf("Error: estimated true error limit must be a \"POSITIVE\" number!\n");
+
+        // a chance to correct your mistake :)
+        printf("\nDo you want to try again? {0: no, 1: yes}\n");
+        fgets(tryAgain_c, sizeof(tryAgain_c), stdin);
+        tryAgain = strtol(tryAgain_c, &ptr, 10);
+        if (tryAgain) {
+            goto ETE;
+        } else {
+            Exit(EXIT_FAILURE);
+        } // end of if goto
+    } // end of ete check
+
+    ERE: //LABEL for goto
+    printf("Enter the estimated relative error limit (enter 0 if you don't want to set an ERE limit):\n");
+    fgets(ere_c, sizeof(ere_c), stdin);
+    ere = strtod(ere_c, &ptr);
+
+    // check ere to be positive
+    if (ere < 0) {
+        printf("Error: estimated relative error limit must be a \"POSITIVE\" number!\n");
+
+        // a chance to correct your mistake :)
+        printf("\nDo you want to try again? {0: no, 1: yes}\n");
+        fgets(tryAgain_c, sizeof(tryAgain_c), stdin);
+        tryAgain = strtol(tryAgain_c, &ptr, 10);
+        if (tryAgain) {
+            goto ERE;
+        } else {
+            Exit(EXIT_FAILURE);
+        } // end of if goto
+    } // end of ere check
+
+    TOL: //LABEL for goto
+    printf("Enter the tolerance limit of difference of function on simplex (enter 0 if you don't want to set a tolerance limit):\n");
+    fgets(tol_c, sizeof(tol_c), stdin);
+    tol = strtod(tol_c, &ptr);
+
+    // check tol to be positive
+    if (tol < 0) {
+        printf("Error: tolerance limit must be a \"POSITIVE\" number!\n");
+
+        // a chance to correct your mistake :)
+        printf("\nDo you want to try again? {0: no, 1: yes}\n");
+        fgets(tryAgain_c, sizeof(tryAgain_c), stdin);
+        tryAgain = strtol(tryAgain_c, &ptr, 10);
+        if (tryAgain) {
+            goto TOL;
+        } else {
+            Exit(EXIT_FAILURE);
+        } // end of if goto
+    } // end of tol check
+
+    MAXITER: //LABEL for goto
+    printf("Enter the maximum iteration limit (must be a positive number):\n");
+    fgets(maxiter_c, sizeof(maxiter_c), stdin);
+    maxiter = strtol(maxiter_c, &ptr, 10);
+
+    // check maximum iteration to be more than 0
+    if (maxiter <= 0) {
+        printf("Error: invalid value for maximum iteration limit!\n");
+
+        // a chance to correct your mistake :)
+        printf("\nDo you want to try again? {0: no, 1: yes}\n");
+        fgets(tryAgain_c, sizeof(tryAgain_c), stdin);
+        tryAgain = strtol(tryAgain_c, &ptr, 10);
+        if (tryAgain) {
+            goto MAXITER;
+        } else {
+            Exit(EXIT_FAILURE);
+        } // end of if goto
+    }// end of if maxiter
+
+    VERBOSE: //LABEL for goto
+    printf("Do you want to see steps? {0: no, 1: yes}:\n");
+    fgets(verbose_c, sizeof(verbose_c), stdin);
+    verbose = strtol(verbose_c, &ptr, 10);
+
+    // check verbose value
+    if (verbose != 0 && verbose != 1) {
+        printf("Error: invalid value for verbose!\n");
+
+        // a chance to correct your mistake :)
+        printf("\nDo you want to try again? {0: no, 1: yes}\n");
+        fgets(tryAgain_c, sizeof(tryAgain_c), stdin);
+        tryAgain = strtol(tryAgain_c, &ptr, 10);
+        if (tryAgain) {
+            goto VERBOSE;
+        } else {
+            Exit(EXIT_FAILURE);
+        } // end of if goto
+    } // end of if verbose
+
+    // calculation
+    result = nelderMead(expression, (unsigned int) dimension, x, size, adaptive, (unsigned int) restarts, ete, ere,
+                        tol, (unsigned int) maxiter, verbose, &flag);
+
+    // if there was an answer
+    if (flag) {
+        printf("\nThis method has found the minimum of the function %swith value %lf at point:\n", expression, result);
+    } else { // if no answer
+        printf("\nThis method didn't find the minimum of the function %s"
+               "the last calculated value is %lf at point:\n", expression, result);
+    } // end of if flag
+
+    for (int i = 0; i < dimension; ++i) {
+        printf("x%d = %lf\n", i + 1, x[i]);
+    } // end of for loop
+
+    // do you want to start again??
+    printf("\nDo you want to start again? {0: no, 1: yes}\n");
+    fgets(tryAgain_c, sizeof(tryAgain_c), stdin);
+    tryAgain = strtol(tryAgain_c, &ptr, 10);
+    if (tryAgain) {
+        goto START;
+    } else {
+        free(x);
+        Exit(EXIT_SUCCESS);
+    } // end of if goto
+} // end of main
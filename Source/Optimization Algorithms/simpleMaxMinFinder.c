@@ -12,10 +12,10 @@ int main() {
 
     // initializing variables
     char expression[INPUT_SIZE];
-    char a[INPUT_SIZE], b[INPUT_SIZE], n_c[INPUT_SIZE], tryAgain_c[INPUT_SIZE];
+    char a[INPUT_SIZE], b[INPUT_SIZE], n_c[INPUT_SIZE], cells_c[INPUT_SIZE], tryAgain_c[INPUT_SIZE];
     char *ptr;
-    int n = 0, tryAgain = 0;
-    double a0, b0;
+    int n = 0, cells = 0, tryAgain = 0;
+    double a0, b0, result[2], values[2];
 
     printf("\t\t\t\tOptimization Algorithm\n"
            "\t\t\t\t Simple MaxMin Finder\n");
@@ -68,12 +68,33 @@ int main() {
             Exit(EXIT_FAILURE);
         } // end of if goto
     } // end of ete check
-    
+
+    CELLS: //LABEL for goto
+    printf("Enter the number of the best local extrema of samples you want to polish (enter 0 to use only samples):\n");
+    fgets(cells_c, sizeof(cells_c), stdin);
+    cells = strtol(cells_c, &ptr, 10);
+
+    // check cells to be positive
+    if (cells < 0) {
+        printf("Error: number of local extrema must be a \"POSITIVE\" number!\n");
+
+        // a chance to correct your mistake :)
+        printf("\nDo you want to try again? {0: no, 1: yes}\n");
+        fgets(tryAgain_c, sizeof(tryAgain_c), stdin);
+        tryAgain = strtol(tryAgain_c, &ptr, 10);
+        if (tryAgain) {
+            goto CELLS;
+        } else {
+            Exit(EXIT_FAILURE);
+        } // end of if goto
+    } // end of cells check
+
     // calculation
-    double *result = simpleMaxMinFinder(expression, a0, b0, (unsigned int) n);
+    maxMinFinder(expression, a0, b0, (unsigned int) n, (unsigned int) cells, 0, 0, 100, result, values);
 
     // show result
     printf("In domain range [%lf, %lf], x maximum = %lf, x minimum = %lf\n", a0, b0, result[0], result[1]);
+    printf("maximum of function = %lf, minimum of function = %lf\n", values[0], values[1]);
 
 
     // do you want to start again??